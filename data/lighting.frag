@@ -0,0 +1,65 @@
+#version 120
+
+// Sun and ambient light are baked into the vertex colours
+uniform bool baked;
+
+// Directional light, direction is in eye space and points to the light
+uniform vec3 sun_direction;
+uniform vec3 sun_diffuse;
+uniform vec3 sun_ambient;
+
+// Point light attached to the camera
+uniform bool  torch;
+uniform vec3  torch_diffuse;
+uniform float torch_constant_attenuation;
+uniform float torch_linear_attenuation;
+
+// Lights of the nearest wall torches, positions are in eye space
+uniform int   wall_torches_count;
+uniform vec3  wall_torch_positions[6];
+uniform vec3  wall_torch_diffuse;
+uniform float wall_torch_quadratic_attenuation;
+
+uniform bool  fog;
+uniform vec3  fog_color;
+uniform float fog_density;
+
+varying vec3 eye_position;
+varying vec3 normal;
+
+void main() {
+    vec3 n = normalize(normal);
+    float distance = length(eye_position);
+
+    vec3 light = vec3(1.0);
+
+    // 0.2 is the fixed-function global ambient
+    if (!baked)
+        light = vec3(0.2) + sun_ambient + sun_diffuse * max(dot(n, sun_direction), 0.0);
+
+    if (torch && distance > 0.0) {
+        float attenuation = 1.0 / (torch_constant_attenuation +
+                                   torch_linear_attenuation * distance);
+
+        light += torch_diffuse * max(dot(n, -eye_position / distance), 0.0) * attenuation;
+    }
+
+    for (int i = 0; i < 6; i++) {
+        if (i >= wall_torches_count)
+            break;
+
+        vec3 to_light = wall_torch_positions[i] - eye_position;
+        float light_distance = length(to_light);
+        float attenuation = 1.0 / (1.0 + wall_torch_quadratic_attenuation *
+                                         light_distance * light_distance);
+
+        light += wall_torch_diffuse * max(dot(n, to_light / light_distance), 0.0) * attenuation;
+    }
+
+    vec3 color = min(gl_Color.rgb * light, vec3(1.0));
+
+    if (fog)
+        color = mix(fog_color, color, clamp(exp(-fog_density * distance), 0.0, 1.0));
+
+    gl_FragColor = vec4(color, gl_Color.a);
+}
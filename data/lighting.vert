@@ -0,0 +1,14 @@
+#version 120
+
+varying vec3 eye_position;
+varying vec3 normal;
+
+void main() {
+    vec4 eye = gl_ModelViewMatrix * gl_Vertex;
+
+    eye_position = eye.xyz;
+    normal = gl_NormalMatrix * gl_Normal;
+
+    gl_FrontColor = gl_Color;
+    gl_Position = gl_ProjectionMatrix * eye;
+}
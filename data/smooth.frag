@@ -0,0 +1,53 @@
+#version 120
+
+// Cheap FXAA-style edge smoothing of the scene target. Edges are found
+// from the luma of the corner texels and blurred along, not across.
+
+uniform sampler2D scene;
+uniform vec2 texel;
+
+float luma(vec3 color) {
+    return dot(color, vec3(0.299, 0.587, 0.114));
+}
+
+void main() {
+    vec2 uv = gl_TexCoord[0].xy;
+
+    vec3 center = texture2D(scene, uv).rgb;
+
+    float luma_nw = luma(texture2D(scene, uv + vec2(-1.0, -1.0) * texel).rgb);
+    float luma_ne = luma(texture2D(scene, uv + vec2( 1.0, -1.0) * texel).rgb);
+    float luma_sw = luma(texture2D(scene, uv + vec2(-1.0,  1.0) * texel).rgb);
+    float luma_se = luma(texture2D(scene, uv + vec2( 1.0,  1.0) * texel).rgb);
+    float luma_m  = luma(center);
+
+    float luma_min = min(luma_m, min(min(luma_nw, luma_ne), min(luma_sw, luma_se)));
+    float luma_max = max(luma_m, max(max(luma_nw, luma_ne), max(luma_sw, luma_se)));
+
+    // Flat areas stay as they are
+    if (luma_max - luma_min < max(0.0312, luma_max * 0.125)) {
+        gl_FragColor = vec4(center, 1.0);
+        return;
+    }
+
+    vec2 direction = vec2(-((luma_nw + luma_ne) - (luma_sw + luma_se)),
+                            (luma_nw + luma_sw) - (luma_ne + luma_se));
+
+    float reduce = max((luma_nw + luma_ne + luma_sw + luma_se) * 0.03125, 0.0078125);
+    float scale  = 1.0 / (min(abs(direction.x), abs(direction.y)) + reduce);
+
+    direction = clamp(direction * scale, vec2(-8.0), vec2(8.0)) * texel;
+
+    vec3 near = 0.5 * (texture2D(scene, uv + direction * (1.0 / 3.0 - 0.5)).rgb +
+                       texture2D(scene, uv + direction * (2.0 / 3.0 - 0.5)).rgb);
+    vec3 far  = near * 0.5 + 0.25 * (texture2D(scene, uv - direction * 0.5).rgb +
+                                     texture2D(scene, uv + direction * 0.5).rgb);
+
+    float luma_far = luma(far);
+
+    // The far samples crossed another edge
+    if (luma_far < luma_min || luma_far > luma_max)
+        gl_FragColor = vec4(near, 1.0);
+    else
+        gl_FragColor = vec4(far, 1.0);
+}
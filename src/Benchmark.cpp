@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+#include <SFML/OpenGL.hpp>
+#include <SFML/System/Clock.hpp>
+
+#include "Game.hpp"
+#include "GraphicEngine.hpp"
+#include "Logger.hpp"
+#include "MazeRenderer.hpp"
+#include "Saver.hpp"
+#include "Settings.hpp"
+#include "utils.hpp"
+
+#include "Gui/MainMenu.hpp"
+
+namespace mazemaze {
+
+Benchmark::Benchmark(Settings& settings, Point2i maze_size, unsigned int seed, int frames) :
+        settings(settings),
+        maze_size(maze_size),
+        seed(seed),
+        frames(frames) {}
+
+Benchmark::Benchmark(Settings& settings, const CameraPath& path) :
+        settings(settings),
+        maze_size(path.maze_size()),
+        seed(path.seed()),
+        frames(path.frames().size()),
+        path(path) {}
+
+Benchmark::~Benchmark() = default;
+
+bool
+Benchmark::run(Point2i resolution) {
+    GraphicEngine& engine = GraphicEngine::inst();
+
+    if (!engine.open_offscreen(resolution))
+        return false;
+
+    // Measure every style from cold, without the others compiling behind it
+    settings.set_inactive_cache_size(0);
+
+    gui::MainMenu main_menu(settings);
+    Saver saver(settings);
+    Game game(main_menu, settings, saver, maze_size);
+
+    if (!game.maze().generate(seed))
+        return false;
+
+    game.player().start(game.maze());
+    game.on_load();
+
+    if (path.frames().empty())
+        script(game.maze());
+
+    m_results.clear();
+
+    for (int id = 0; id < game.renderers_count(); id++) {
+        settings.set_renderer(id);
+
+        // The benchmark draws on this thread, so the style is switched
+        // here, before its first frame is timed
+        game.set_renderer(id, settings.inactive_cache_size());
+
+        Logger::inst().log_status(fmt("Benchmarking %s.", game.renderer_name(id)));
+
+        RenderStats& stats = engine.stats();
+
+        stats.compiled_chunks = 0;
+
+        Result result {};
+        std::vector<double> totals;
+        long draw_calls = 0;
+
+        result.name = game.renderer_name(id);
+        result.frames = frames;
+
+        for (const auto& frame : path.frames()) {
+            game.player().place(frame.position, frame.rotation);
+
+            sf::Clock clock;
+
+            // Styles are ticked by the scene pass from the snapshot
+            game.capture(frame.delta_time);
+            game.sync();
+            engine.render_offscreen(game);
+
+            double cpu = clock.getElapsedTime().asMicroseconds() / 1000.0;
+
+            glFinish();
+
+            double total = clock.getElapsedTime().asMicroseconds() / 1000.0;
+
+            result.cpu_mean   += cpu;
+            result.total_mean += total;
+
+            totals.push_back(total);
+            draw_calls += stats.draw_calls;
+        }
+
+        if (!totals.empty()) {
+            result.cpu_mean   /= totals.size();
+            result.total_mean /= totals.size();
+            result.draw_calls  = draw_calls / static_cast<double>(totals.size());
+
+            result.total_p50 = percentile(totals, 0.5);
+            result.total_p90 = percentile(totals, 0.9);
+            result.total_p99 = percentile(totals, 0.99);
+            result.total_max = percentile(totals, 1.0);
+        }
+
+        result.compiled_chunks = stats.compiled_chunks;
+
+        m_results.push_back(result);
+    }
+
+    return true;
+}
+
+void
+Benchmark::print(std::ostream& stream) const {
+    stream << fmt("maze %dx%d, seed %u, %d frames, times in ms\n",
+                  maze_size.x, maze_size.y, seed, frames);
+
+    stream << fmt("%-12s %8s %8s %8s %8s %8s %8s %8s %9s\n",
+                  "style", "cpu avg", "avg", "p50", "p90", "p99", "max", "calls", "compiled");
+
+    for (const auto& result : m_results)
+        stream << fmt("%-12s %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f %8.1f %9d\n",
+                      result.name.c_str(),
+                      result.cpu_mean,
+                      result.total_mean,
+                      result.total_p50,
+                      result.total_p90,
+                      result.total_p99,
+                      result.total_max,
+                      result.draw_calls,
+                      result.compiled_chunks);
+}
+
+const std::vector<Benchmark::Result>&
+Benchmark::results() const {
+    return m_results;
+}
+
+void
+Benchmark::script(Maze& maze) {
+    const float delta_time = 1.0f / 60.0f;
+    const float speed = 3.0f;
+
+    std::vector<Pointf> cells = solve(maze);
+
+    for (int frame = 0; frame < frames; frame++) {
+        Rotation rotation;
+        Pointf position = walk(cells, frame * delta_time * speed, rotation);
+
+        path.add(position, rotation, delta_time);
+    }
+}
+
+std::vector<Pointf>
+Benchmark::solve(Maze& maze) const {
+    Point2i size = maze.size();
+    Point2i start = maze.start();
+    Point2i exit = maze.exit();
+
+    std::vector<int> parents(size.x * size.y, -1);
+    std::queue<Point2i> queue;
+
+    parents[start.y * size.x + start.x] = start.y * size.x + start.x;
+    queue.push(start);
+
+    while (!queue.empty() && parents[exit.y * size.x + exit.x] == -1) {
+        Point2i cell = queue.front();
+        queue.pop();
+
+        for (int side = 0; side < 4; side++) {
+            Point2i next;
+
+            side_to_coords(side, next.x, next.y);
+
+            next.x += cell.x;
+            next.y += cell.y;
+
+            if (next.x < 0 || next.x >= size.x || next.y < 0 || next.y >= size.y)
+                continue;
+
+            int index = next.y * size.x + next.x;
+
+            if (parents[index] != -1 || !maze.get_opened(next))
+                continue;
+
+            parents[index] = cell.y * size.x + cell.x;
+            queue.push(next);
+        }
+    }
+
+    std::vector<Pointf> cells;
+
+    int index = exit.y * size.x + exit.x;
+
+    if (parents[index] == -1)
+        index = start.y * size.x + start.x;
+
+    for (;;) {
+        cells.emplace_back((index % size.x) + 0.5f, 0.0f, (index / size.x) + 0.5f);
+
+        if (parents[index] == index)
+            break;
+
+        index = parents[index];
+    }
+
+    std::reverse(cells.begin(), cells.end());
+
+    return cells;
+}
+
+Pointf
+Benchmark::walk(const std::vector<Pointf>& cells, float distance, Rotation& rotation) const {
+    if (cells.size() < 2) {
+        rotation = Rotation();
+        return cells.front();
+    }
+
+    // Walk there and back again, so long runs on small mazes keep moving
+    float length = cells.size() - 1;
+    float cycle = std::fmod(distance, length * 2.0f);
+    bool back = cycle > length;
+    float t = back ? length * 2.0f - cycle : cycle;
+
+    std::size_t i = std::min(static_cast<std::size_t>(t), cells.size() - 2);
+    float k = t - i;
+
+    const Pointf& a = cells[i];
+    const Pointf& b = cells[i + 1];
+
+    Point2f direction(b.x - a.x, b.z - a.z);
+
+    if (back) {
+        direction.x = -direction.x;
+        direction.y = -direction.y;
+    }
+
+    rotation = Rotation(0.0f, std::atan2(direction.x, -direction.y), 0.0f);
+
+    return Pointf(a.x + (b.x - a.x) * k, 0.0f, a.z + (b.z - a.z) * k);
+}
+
+double
+Benchmark::percentile(std::vector<double>& times, double fraction) {
+    std::size_t index = std::min(static_cast<std::size_t>(fraction * times.size()),
+                                 times.size() - 1);
+
+    std::nth_element(times.begin(), times.begin() + index, times.end());
+
+    return times[index];
+}
+
+}
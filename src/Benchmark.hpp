@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "CameraPath.hpp"
+#include "Point.hpp"
+#include "Point2.hpp"
+#include "Rotation.hpp"
+
+namespace mazemaze {
+
+class Maze;
+class Settings;
+
+// Renders a scripted or recorded walk through a generated maze into an
+// offscreen target with every maze renderer in turn and collects frame times.
+class Benchmark {
+public:
+    struct Result {
+        std::string name;
+        int    frames;
+        double cpu_mean;
+        double total_mean;
+        double total_p50;
+        double total_p90;
+        double total_p99;
+        double total_max;
+        double draw_calls;
+        int    compiled_chunks;
+    };
+
+    explicit Benchmark(Settings& settings, Point2i maze_size, unsigned int seed, int frames);
+    explicit Benchmark(Settings& settings, const CameraPath& path);
+    ~Benchmark();
+
+    bool run(Point2i resolution);
+    void print(std::ostream& stream) const;
+
+    const std::vector<Result>& results() const;
+
+private:
+    Settings& settings;
+    Point2i maze_size;
+    unsigned int seed;
+    int frames;
+
+    CameraPath path;
+    std::vector<Result> m_results;
+
+    void script(Maze& maze);
+    std::vector<Pointf> solve(Maze& maze) const;
+    Pointf walk(const std::vector<Pointf>& cells, float distance, Rotation& rotation) const;
+
+    static double percentile(std::vector<double>& times, double fraction);
+};
+
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -36,31 +36,20 @@ Camera::~Camera() = default;
 
 void
 Camera::setup_rotation() {
-    float todeg = static_cast<float>(180.0 / M_PI);
-
-    glRotatef(m_rotation.pitch() * todeg, 1.0, 0.0, 0.0);
-    glRotatef(m_rotation.yaw()   * todeg, 0.0, 1.0, 0.0);
-    glRotatef(m_rotation.roll()  * todeg, 0.0, 0.0, 1.0);
+    glMultMatrixf(view_rotation().data());
 }
 
 void
 Camera::setup_translation() {
-    glTranslatef(-m_position.x, -m_position.y, -m_position.z);
+    glMultMatrixf(Matrix4f::translation(Pointf(-m_position.x,
+                                               -m_position.y,
+                                               -m_position.z)).data());
 }
 
 void
 Camera::setup_perspective() {
-    auto window_size = GraphicEngine::inst().window_size();
-
-    double ratio = window_size.x / static_cast<double>(window_size.y);
-
     glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-
-    glFrustum(-ratio * near_dist, ratio * near_dist,
-              -1.0   * near_dist, 1.0   * near_dist,
-              (ratio * near_dist) / tan(m_fov * (M_PI / 360.0)),
-              far_dist);
+    glLoadMatrixf(projection().data());
 
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
@@ -76,14 +65,65 @@ Camera::rotation() {
     return m_rotation;
 }
 
+const Pointf&
+Camera::position() const {
+    return m_position;
+}
+
+const Rotation&
+Camera::rotation() const {
+    return m_rotation;
+}
+
 double
 Camera::fov() const {
     return m_fov;
 }
 
+Frustum
+Camera::frustum() const {
+    return Frustum(m_position, m_rotation, m_fov, ratio(), frustum_near(), far_dist);
+}
+
+Matrix4f
+Camera::projection() const {
+    double ratio = Camera::ratio();
+
+    return Matrix4f::frustum(-ratio * near_dist, ratio * near_dist,
+                             -1.0   * near_dist, 1.0   * near_dist,
+                             frustum_near(),
+                             far_dist);
+}
+
+Matrix4f
+Camera::view_rotation() const {
+    return Matrix4f::rotation_x(m_rotation.pitch()) *
+           Matrix4f::rotation_y(m_rotation.yaw()) *
+           Matrix4f::rotation_z(m_rotation.roll());
+}
+
+Matrix4f
+Camera::view() const {
+    return view_rotation() * Matrix4f::translation(Pointf(-m_position.x,
+                                                          -m_position.y,
+                                                          -m_position.z));
+}
+
 void
 Camera::set_fov(double fov) {
     m_fov = fov;
 }
 
+double
+Camera::ratio() const {
+    auto window_size = GraphicEngine::inst().scene_size();
+
+    return window_size.x / static_cast<double>(window_size.y);
+}
+
+double
+Camera::frustum_near() const {
+    return (ratio() * near_dist) / tan(m_fov * (M_PI / 360.0));
+}
+
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "Frustum.hpp"
+#include "Matrix4.hpp"
 #include "Point.hpp"
 #include "Rotation.hpp"
 
@@ -35,7 +37,15 @@ public:
     Pointf  & position();
     Rotation& rotation();
 
-    double fov() const;
+    const Pointf  & position() const;
+    const Rotation& rotation() const;
+
+    double  fov() const;
+    Frustum frustum() const;
+
+    Matrix4f projection() const;
+    Matrix4f view_rotation() const;
+    Matrix4f view() const;
 
     void set_fov(double fov);
 
@@ -46,6 +56,9 @@ private:
     double m_fov;
     double near_dist;
     double far_dist;
+
+    double ratio() const;
+    double frustum_near() const;
 };
 
 }
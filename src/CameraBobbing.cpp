@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2021-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -45,6 +45,8 @@ CameraBobbing::CameraBobbing() :
     pos_coeff(0.0f),
     time_coeff(0.0f),
     last_pitch(0.0f),
+    m_offset(0.0f, 0.0f),
+    old_offset(0.0f, 0.0f),
     easing_type(false),
     time(0.0f) {
 }
@@ -55,11 +57,9 @@ void
 CameraBobbing::tick(Player& player, float delta_time) {
     Camera& camera = player.camera();
 
-    auto&  position = camera.position();
     auto&  rotation = camera.rotation();
 
     float  current_rot;
-    Pointf current;
 
     float  rot_coeff_with_easing;
     float  pos_coeff_with_easing;
@@ -107,20 +107,24 @@ CameraBobbing::tick(Player& player, float delta_time) {
 
     current_rot = rot_raw * rot_amount * rot_coeff_with_easing;
 
-    current.x =           std::cos(time * pos_speed)  * pos_amount * pos_coeff_with_easing;
-    current.y = -std::abs(std::sin(time * pos_speed)) * pos_amount * pos_coeff_with_easing;
+    old_offset = m_offset;
 
-    rotation.set_pitch(rotation.pitch() - last_pitch + current_rot);
+    m_offset.x =           std::cos(time * pos_speed)  * pos_amount * pos_coeff_with_easing;
+    m_offset.y = -std::abs(std::sin(time * pos_speed)) * pos_amount * pos_coeff_with_easing;
 
-    position.x += current.x * std::cos(rotation.yaw());
-    position.y += current.y;
-    position.z += current.x * std::sin(rotation.yaw());
+    rotation.set_pitch(rotation.pitch() - last_pitch + current_rot);
 
     last_pitch = current_rot;
 
     time += delta_time * time_coeff_with_easing;
 }
 
+Point2f
+CameraBobbing::offset(float alpha) const {
+    return Point2f(old_offset.x + (m_offset.x - old_offset.x) * alpha,
+                   old_offset.y + (m_offset.y - old_offset.y) * alpha);
+}
+
 float
 CameraBobbing::ease_out_cubic(float x) {
     return 1.0f - ease_in_cubic(1.0f - x);
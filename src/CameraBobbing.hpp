@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2021-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "ITickable.hpp"
+#include "Point2.hpp"
 
 namespace mazemaze {
 
@@ -30,6 +31,9 @@ public:
 
     void tick(Player& player, float delta_time);
 
+    // Sideways and vertical camera offset, blended between the last two ticks
+    Point2f offset(float alpha) const;
+
 private:
     float rot_coeff;
     float pos_coeff;
@@ -37,6 +41,9 @@ private:
 
     float last_pitch;
 
+    Point2f m_offset;
+    Point2f old_offset;
+
     bool easing_type;
 
     float time;
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CameraPath.hpp"
+
+#include <cstring>
+#include <fstream>
+
+namespace mazemaze {
+
+static const char MAGIC[4] { 'M', 'Z', 'C', 'P' };
+
+CameraPath::CameraPath() :
+        m_seed(0),
+        m_maze_size(0, 0) {}
+
+CameraPath::~CameraPath() = default;
+
+bool
+CameraPath::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+    std::streamoff file_size = file.tellg();
+
+    file.seekg(0);
+
+    Header header;
+
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(Header)))
+        return false;
+
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION)
+        return false;
+
+    // A truncated or corrupt file must not make us allocate whatever its
+    // header says
+    std::size_t data_size = static_cast<std::size_t>(file_size) - sizeof(Header);
+
+    if (data_size % (7 * sizeof(float)) != 0 ||
+            data_size / (7 * sizeof(float)) != header.frames_count)
+        return false;
+
+    std::vector<float> data(static_cast<std::size_t>(header.frames_count) * 7);
+
+    if (!file.read(reinterpret_cast<char*>(data.data()), data.size() * sizeof(float)))
+        return false;
+
+    m_seed = header.seed;
+    m_maze_size = Point2i(header.maze_width, header.maze_height);
+
+    m_frames.clear();
+    m_frames.reserve(header.frames_count);
+
+    for (std::size_t i = 0; i < data.size(); i += 7)
+        m_frames.push_back(Frame {
+            Pointf(data[i], data[i + 1], data[i + 2]),
+            Rotation(data[i + 3], data[i + 4], data[i + 5]),
+            data[i + 6]
+        });
+
+    return true;
+}
+
+bool
+CameraPath::save(const std::string& path) const {
+    Header header;
+
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version      = VERSION;
+    header.seed         = m_seed;
+    header.maze_width   = m_maze_size.x;
+    header.maze_height  = m_maze_size.y;
+    header.frames_count = m_frames.size();
+
+    std::vector<float> data;
+
+    data.reserve(m_frames.size() * 7);
+
+    for (const auto& frame : m_frames)
+        data.insert(data.end(), {
+            frame.position.x, frame.position.y, frame.position.z,
+            frame.rotation.pitch(), frame.rotation.yaw(), frame.rotation.roll(),
+            frame.delta_time
+        });
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+
+    return static_cast<bool>(file);
+}
+
+void
+CameraPath::add(Pointf position, Rotation rotation, float delta_time) {
+    m_frames.push_back(Frame { position, rotation, delta_time });
+}
+
+void
+CameraPath::clear() {
+    m_frames.clear();
+}
+
+const std::vector<CameraPath::Frame>&
+CameraPath::frames() const {
+    return m_frames;
+}
+
+unsigned int
+CameraPath::seed() const {
+    return m_seed;
+}
+
+Point2i
+CameraPath::maze_size() const {
+    return m_maze_size;
+}
+
+void
+CameraPath::set_maze(unsigned int seed, Point2i maze_size) {
+    m_seed = seed;
+    m_maze_size = maze_size;
+}
+
+}
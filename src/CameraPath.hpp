@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Point.hpp"
+#include "Point2.hpp"
+#include "Rotation.hpp"
+
+namespace mazemaze {
+
+// Player poses recorded frame by frame together with the maze they were
+// recorded in, so a walk can be replayed exactly.
+class CameraPath {
+public:
+    struct Frame {
+        Pointf   position;
+        Rotation rotation;
+        float    delta_time;
+    };
+
+    explicit CameraPath();
+    ~CameraPath();
+
+    bool load(const std::string& path);
+    bool save(const std::string& path) const;
+
+    void add(Pointf position, Rotation rotation, float delta_time);
+    void clear();
+
+    const std::vector<Frame>& frames() const;
+    unsigned int              seed() const;
+    Point2i                   maze_size() const;
+
+    void set_maze(unsigned int seed, Point2i maze_size);
+
+private:
+    struct Header {
+        char          magic[4];
+        std::uint32_t version;
+        std::uint32_t seed;
+        std::int32_t  maze_width;
+        std::int32_t  maze_height;
+        std::uint32_t frames_count;
+    };
+
+    static const std::uint32_t VERSION = 1;
+
+    std::vector<Frame> m_frames;
+    unsigned int m_seed;
+    Point2i m_maze_size;
+};
+
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CellVisibility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Chunk.hpp"
+#include "Frustum.hpp"
+#include "Maze.hpp"
+
+namespace mazemaze {
+
+CellVisibility::CellVisibility(Maze& maze, int rays_count, int distance) :
+        maze(maze),
+        rays_count(rays_count),
+        distance(distance),
+        everything(true),
+        stamp(0),
+        cells((distance * 2 + 1) * (distance * 2 + 1), 0) {}
+
+CellVisibility::~CellVisibility() = default;
+
+void
+CellVisibility::update(Pointf position, const Frustum& frustum) {
+    chunks.clear();
+
+    // Walls do not hide anything if the camera is above or below them
+    everything = position.y < 0.0f || position.y > 1.0f ||
+                 !maze.get_opened(Point2i(static_cast<int>(std::floor(position.x)),
+                                          static_cast<int>(std::floor(position.z))));
+
+    if (everything)
+        return;
+
+    origin = Point2i(static_cast<int>(std::floor(position.x)) - distance,
+                     static_cast<int>(std::floor(position.z)) - distance);
+
+    if (++stamp == 0) {
+        std::fill(cells.begin(), cells.end(), 0);
+        stamp = 1;
+    }
+
+    float step = static_cast<float>(2.0 * M_PI) / rays_count;
+
+    for (int i = 0; i < rays_count; i++)
+        cast(position, i * step, frustum);
+}
+
+bool
+CellVisibility::chunk_visible(int num) const {
+    return everything || std::find(chunks.begin(), chunks.end(), num) != chunks.end();
+}
+
+bool
+CellVisibility::cell_visible(Point2i cell) const {
+    if (everything)
+        return true;
+
+    Point2i local(cell.x - origin.x, cell.y - origin.y);
+    int side = distance * 2 + 1;
+
+    if (local.x < 0 || local.x >= side || local.y < 0 || local.y >= side)
+        return false;
+
+    return cells[local.y * side + local.x] == stamp;
+}
+
+void
+CellVisibility::cast(Pointf position, float angle, const Frustum& frustum) {
+    const float inf = std::numeric_limits<float>::infinity();
+
+    Point2f dir(std::cos(angle), std::sin(angle));
+    Point2i cell(static_cast<int>(std::floor(position.x)),
+                 static_cast<int>(std::floor(position.z)));
+    Point2i step(dir.x < 0.0f ? -1 : 1, dir.y < 0.0f ? -1 : 1);
+
+    Point2f delta(dir.x != 0.0f ? std::abs(1.0f / dir.x) : inf,
+                  dir.y != 0.0f ? std::abs(1.0f / dir.y) : inf);
+
+    Point2f next(
+        (step.x > 0 ? cell.x + 1.0f - position.x : position.x - cell.x) * delta.x,
+        (step.y > 0 ? cell.y + 1.0f - position.z : position.z - cell.y) * delta.y
+    );
+
+    mark(cell, frustum);
+
+    while (true) {
+        float travelled;
+
+        if (next.x < next.y) {
+            travelled = next.x;
+            next.x += delta.x;
+            cell.x += step.x;
+        } else {
+            travelled = next.y;
+            next.y += delta.y;
+            cell.y += step.y;
+        }
+
+        if (travelled + 1.0f > distance)
+            break;
+
+        mark(cell, frustum);
+
+        if (!maze.get_opened(cell))
+            break;
+    }
+}
+
+void
+CellVisibility::mark(Point2i cell, const Frustum& frustum) {
+    int side = distance * 2 + 1;
+    unsigned int& cell_stamp = cells[(cell.y - origin.y) * side + (cell.x - origin.x)];
+
+    if (cell_stamp == stamp)
+        return;
+
+    if (!frustum.intersects(Pointf(cell.x, 0.0f, cell.y), Pointf(cell.x + 1.0f, 1.0f, cell.y + 1.0f)))
+        return;
+
+    cell_stamp = stamp;
+
+    if (cell.x < 0 || cell.y < 0 || cell.x >= maze.size().x || cell.y >= maze.size().y)
+        return;
+
+    int num = (cell.y / Chunk::SIZE) * maze.chunks_count().x + cell.x / Chunk::SIZE;
+
+    if (std::find(chunks.begin(), chunks.end(), num) == chunks.end())
+        chunks.push_back(num);
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Point.hpp"
+#include "Point2.hpp"
+
+namespace mazemaze {
+
+class Maze;
+class Frustum;
+
+class CellVisibility {
+public:
+    explicit CellVisibility(Maze& maze, int rays_count, int distance);
+    ~CellVisibility();
+
+    void update(Pointf position, const Frustum& frustum);
+
+    bool chunk_visible(int num) const;
+    bool cell_visible(Point2i cell) const;
+
+private:
+    Maze& maze;
+
+    int rays_count;
+    int distance;
+    bool everything;
+
+    Point2i origin;
+    unsigned int stamp;
+    std::vector<unsigned int> cells;
+    std::vector<int> chunks;
+
+    void cast(Pointf position, float angle, const Frustum& frustum);
+    void mark(Point2i cell, const Frustum& frustum);
+};
+
+}
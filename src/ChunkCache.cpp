@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ChunkCache.hpp"
+
+#include <algorithm>
+
+#include <SFML/OpenGL.hpp>
+
+#include "Logger.hpp"
+#include "utils.hpp"
+
+namespace mazemaze {
+
+ChunkCache::ChunkCache(std::size_t budget) :
+        lods_count(1),
+        m_budget(budget),
+        m_resident_bytes(0) {}
+
+ChunkCache::~ChunkCache() = default;
+
+void
+ChunkCache::init(int chunks_count, int lods_count) {
+    clear();
+
+    ChunkCache::lods_count = lods_count;
+
+    entries.assign(chunks_count, Entry { 0, 0, 0, lru.end() });
+}
+
+void
+ChunkCache::clear() {
+    for (int num : lru)
+        glDeleteLists(entries[num].lists, lods_count);
+
+    for (auto& entry : entries) {
+        entry.lists    = 0;
+        entry.compiled = 0;
+        entry.bytes    = 0;
+        entry.lru      = lru.end();
+    }
+
+    lru.clear();
+    m_resident_bytes = 0;
+}
+
+void
+ChunkCache::acquire(int num) {
+    Entry& entry = entries[num];
+
+    if (entry.lists == 0) {
+        entry.lists = glGenLists(lods_count);
+        entry.lru   = lru.insert(lru.begin(), num);
+    } else {
+        touch(num);
+    }
+}
+
+void
+ChunkCache::touch(int num) {
+    Entry& entry = entries[num];
+
+    if (entry.lists != 0)
+        lru.splice(lru.begin(), lru, entry.lru);
+}
+
+void
+ChunkCache::evict(int num) {
+    Entry& entry = entries[num];
+
+    if (entry.lists == 0)
+        return;
+
+    Logger::inst().log_debug(fmt("Evicting chunk %d.", num));
+
+    glDeleteLists(entry.lists, lods_count);
+
+    m_resident_bytes -= entry.bytes;
+
+    lru.erase(entry.lru);
+
+    entry.lists    = 0;
+    entry.compiled = 0;
+    entry.bytes    = 0;
+    entry.lru      = lru.end();
+}
+
+void
+ChunkCache::trim(const int pinned[], int pinned_count) {
+    auto it = lru.end();
+
+    while (m_resident_bytes > m_budget && it != lru.begin()) {
+        int num = *--it;
+
+        if (std::find(pinned, pinned + pinned_count, num) != pinned + pinned_count)
+            continue;
+
+        it = std::next(it);
+        evict(num);
+    }
+}
+
+bool
+ChunkCache::resident(int num) const {
+    return entries[num].lists != 0;
+}
+
+bool
+ChunkCache::compiled(int num, int lod) const {
+    return entries[num].compiled & (1 << lod);
+}
+
+unsigned int
+ChunkCache::list(int num, int lod) const {
+    return entries[num].lists + lod;
+}
+
+std::size_t
+ChunkCache::budget() const {
+    return m_budget;
+}
+
+int
+ChunkCache::resident_count() const {
+    return lru.size();
+}
+
+std::size_t
+ChunkCache::resident_bytes() const {
+    return m_resident_bytes;
+}
+
+void
+ChunkCache::set_compiled(int num, int lod, std::size_t bytes) {
+    Entry& entry = entries[num];
+
+    if (entry.compiled & (1 << lod))
+        return;
+
+    entry.compiled |= 1 << lod;
+    entry.bytes += bytes;
+
+    m_resident_bytes += bytes;
+}
+
+void
+ChunkCache::set_budget(std::size_t budget) {
+    m_budget = budget;
+}
+
+}
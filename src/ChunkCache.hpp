@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <vector>
+
+namespace mazemaze {
+
+class ChunkCache {
+public:
+    explicit ChunkCache(std::size_t budget);
+    ~ChunkCache();
+
+    void init(int chunks_count, int lods_count);
+    void clear();
+
+    void acquire(int num);
+    void touch(int num);
+    void evict(int num);
+    void trim(const int pinned[], int pinned_count);
+
+    bool         resident(int num) const;
+    bool         compiled(int num, int lod) const;
+    unsigned int list(int num, int lod) const;
+    std::size_t  budget() const;
+    int          resident_count() const;
+    std::size_t  resident_bytes() const;
+
+    void set_compiled(int num, int lod, std::size_t bytes);
+    void set_budget(std::size_t budget);
+
+private:
+    struct Entry {
+        unsigned int lists;
+        unsigned int compiled;
+        std::size_t bytes;
+        std::list<int>::iterator lru;
+    };
+
+    std::vector<Entry> entries;
+    std::list<int> lru;
+
+    int lods_count;
+
+    std::size_t m_budget;
+    std::size_t m_resident_bytes;
+};
+
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DynamicResolution.hpp"
+
+#include <algorithm>
+
+#include "Logger.hpp"
+#include "utils.hpp"
+
+namespace mazemaze {
+
+DynamicResolution::DynamicResolution() :
+        m_enabled(false),
+        m_scale(1.0f),
+        average(0.0f),
+        slow_frames(0),
+        fast_frames(0) {}
+
+DynamicResolution::~DynamicResolution() = default;
+
+void
+DynamicResolution::tick(float frame_time, float target_time) {
+    if (!m_enabled)
+        return;
+
+    average += (frame_time - average) * 0.1f;
+
+    // Going down has to be quick to stop stutter, going up slow so that
+    // a single fast frame doesn't undo it
+    if (average > target_time * 1.05f) {
+        slow_frames++;
+        fast_frames = 0;
+    } else if (average < target_time * 0.8f) {
+        fast_frames++;
+        slow_frames = 0;
+    } else {
+        slow_frames = 0;
+        fast_frames = 0;
+    }
+
+    float old_scale = m_scale;
+
+    if (slow_frames >= 15 && m_scale > MIN_SCALE) {
+        m_scale = std::max(MIN_SCALE, m_scale - STEP);
+        slow_frames = 0;
+    }
+
+    if (fast_frames >= 90 && m_scale < 1.0f) {
+        m_scale = std::min(1.0f, m_scale + STEP);
+        fast_frames = 0;
+    }
+
+    if (m_scale != old_scale)
+        Logger::inst().log_debug(fmt("Resolution scale is %.1f, work takes %.1f of %.1f ms.",
+                                     m_scale, average * 1000.0f, target_time * 1000.0f));
+}
+
+void
+DynamicResolution::set_enabled(bool enabled) {
+    m_enabled = enabled;
+
+    m_scale = 1.0f;
+    slow_frames = 0;
+    fast_frames = 0;
+}
+
+float
+DynamicResolution::scale() const {
+    return m_scale;
+}
+
+bool
+DynamicResolution::enabled() const {
+    return m_enabled;
+}
+
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace mazemaze {
+
+// Picks the resolution scale of the maze pass from recent frame times.
+// The scale moves in steps and only after the frame time stayed off the
+// target for a while, so it neither oscillates nor reallocates the scene
+// target every frame.
+class DynamicResolution {
+public:
+    explicit DynamicResolution();
+    ~DynamicResolution();
+
+    void tick(float frame_time, float target_time);
+
+    void set_enabled(bool enabled);
+
+    float scale() const;
+    bool  enabled() const;
+
+private:
+    static constexpr float MIN_SCALE = 0.5f;
+    static constexpr float STEP      = 0.1f;
+
+    bool  m_enabled;
+    float m_scale;
+    float average;
+    int   slow_frames;
+    int   fast_frames;
+};
+
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FramePacer.hpp"
+
+#include <thread>
+
+namespace mazemaze {
+
+FramePacer::FramePacer() :
+        m_limit(0),
+        period(clock::duration::zero()),
+        deadline(clock::now()) {}
+
+FramePacer::~FramePacer() = default;
+
+void
+FramePacer::wait() {
+    if (m_limit == 0)
+        return;
+
+    // Sleeping can overshoot by about a scheduler tick, so wake up early
+    // and spin the rest
+    const auto spin_time = std::chrono::milliseconds(2);
+
+    deadline += period;
+
+    auto now = clock::now();
+
+    // Don't try to catch up after a long frame, it would only cause a burst
+    if (deadline < now - period) {
+        deadline = now;
+        return;
+    }
+
+    if (deadline - now > spin_time)
+        std::this_thread::sleep_for(deadline - now - spin_time);
+
+    while (clock::now() < deadline)
+        std::this_thread::yield();
+}
+
+void
+FramePacer::set_limit(unsigned int fps) {
+    if (fps == m_limit)
+        return;
+
+    m_limit = fps;
+
+    if (fps != 0)
+        period = std::chrono::duration_cast<clock::duration>(std::chrono::seconds(1)) / fps;
+
+    deadline = clock::now();
+}
+
+unsigned int
+FramePacer::limit() const {
+    return m_limit;
+}
+
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+
+namespace mazemaze {
+
+// Caps the frame rate by sleeping most of the remaining frame time and
+// spinning the last bit, since sleep granularity is too coarse for even
+// frame pacing.
+class FramePacer {
+public:
+    explicit FramePacer();
+    ~FramePacer();
+
+    void wait();
+
+    void set_limit(unsigned int fps);
+    unsigned int limit() const;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    unsigned int m_limit;
+    clock::duration period;
+    clock::time_point deadline;
+};
+
+}
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FrameProfiler.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include <SFML/OpenGL.hpp>
+#include <SFML/Window/Context.hpp>
+
+#include "Logger.hpp"
+#include "utils.hpp"
+
+#ifndef GL_TIME_ELAPSED
+# define GL_TIME_ELAPSED 0x88BF
+#endif
+
+#ifndef GL_QUERY_RESULT
+# define GL_QUERY_RESULT 0x8866
+#endif
+
+#ifndef GL_QUERY_RESULT_AVAILABLE
+# define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+
+#ifndef APIENTRY
+# define APIENTRY
+#endif
+
+namespace mazemaze {
+
+// Timer queries are not in the GL 1.1 headers, so load them at runtime
+typedef void (APIENTRY *GenQueries)          (GLsizei n, GLuint* ids);
+typedef void (APIENTRY *BeginQuery)          (GLenum target, GLuint id);
+typedef void (APIENTRY *EndQuery)            (GLenum target);
+typedef void (APIENTRY *GetQueryObjectiv)    (GLuint id, GLenum name, GLint* params);
+typedef void (APIENTRY *GetQueryObjectui64v) (GLuint id, GLenum name, std::uint64_t* params);
+
+static GenQueries          gl_gen_queries            = nullptr;
+static BeginQuery          gl_begin_query            = nullptr;
+static EndQuery            gl_end_query              = nullptr;
+static GetQueryObjectiv    gl_get_query_objectiv     = nullptr;
+static GetQueryObjectui64v gl_get_query_objectui64v  = nullptr;
+
+FrameProfiler::FrameProfiler() :
+        initialized(false),
+        cpu_only(false),
+        m_gpu_timing(false),
+        last_log(clock::now()),
+        cpu_frame{},
+        cpu_samples{},
+        gpu_samples{},
+        gpu_valid{},
+        queries{},
+        queries_used{},
+        frame(0) {}
+
+FrameProfiler::~FrameProfiler() = default;
+
+void
+FrameProfiler::begin(Phase phase) {
+    if (!initialized && !cpu_only)
+        init();
+
+    starts[phase] = clock::now();
+
+    if (m_gpu_timing) {
+        int slot = frame % QUERY_FRAMES;
+
+        gl_begin_query(GL_TIME_ELAPSED, queries[slot][phase]);
+        queries_used[slot][phase] = true;
+    }
+}
+
+void
+FrameProfiler::end(Phase phase) {
+    using namespace std::chrono;
+
+    cpu_frame[phase] += duration<float, std::milli>(clock::now() - starts[phase]).count();
+
+    if (m_gpu_timing)
+        gl_end_query(GL_TIME_ELAPSED);
+}
+
+void
+FrameProfiler::end_frame() {
+    int sample = frame % SAMPLES;
+
+    for (int i = 0; i < PHASES_COUNT; i++) {
+        cpu_samples[i][sample] = cpu_frame[i];
+        cpu_frame[i] = 0.0f;
+    }
+
+    // Results of the oldest slot are QUERY_FRAMES - 1 frames old, so they
+    // are normally ready without stalling the pipeline
+    if (m_gpu_timing)
+        collect_gpu((frame + 1) % QUERY_FRAMES, sample);
+
+    frame++;
+
+    if (clock::now() - last_log >= std::chrono::seconds(5)) {
+        last_log = clock::now();
+        log();
+    }
+}
+
+void
+FrameProfiler::reset() {
+    // Queries die with the context, so new ones are made in the next one
+    initialized = false;
+    m_gpu_timing = false;
+
+    for (auto& slot : queries_used)
+        std::fill(std::begin(slot), std::end(slot), false);
+}
+
+void
+FrameProfiler::set_cpu_only(bool cpu_only) {
+    FrameProfiler::cpu_only = cpu_only;
+
+    reset();
+}
+
+FrameProfiler::Timing
+FrameProfiler::timing(Phase phase) const {
+    Timing timing {};
+    int count = std::min(frame, SAMPLES);
+    int gpu_count = 0;
+
+    for (int i = 0; i < count; i++) {
+        timing.cpu_avg += cpu_samples[phase][i];
+        timing.cpu_max = std::max(timing.cpu_max, cpu_samples[phase][i]);
+
+        if (!gpu_valid[phase][i])
+            continue;
+
+        timing.gpu_avg += gpu_samples[phase][i];
+        timing.gpu_max = std::max(timing.gpu_max, gpu_samples[phase][i]);
+        gpu_count++;
+    }
+
+    if (count > 0)
+        timing.cpu_avg /= count;
+
+    if (gpu_count > 0)
+        timing.gpu_avg /= gpu_count;
+
+    return timing;
+}
+
+float
+FrameProfiler::last_gpu_frame() const {
+    int count = std::min(frame, SAMPLES);
+
+    // The newest frame whose queries all came back, 0 if there is none
+    for (int back = 1; back <= count; back++) {
+        int sample = (frame - back) % SAMPLES;
+        float sum = 0.0f;
+        bool complete = true;
+
+        for (int i = 0; i < PHASES_COUNT && complete; i++) {
+            if (i == DISPLAY)
+                continue;
+
+            complete = gpu_valid[i][sample];
+            sum += gpu_samples[i][sample];
+        }
+
+        if (complete)
+            return sum;
+    }
+
+    return 0.0f;
+}
+
+float
+FrameProfiler::last_cpu(Phase phase) const {
+    if (frame == 0)
+        return 0.0f;
+
+    return cpu_samples[phase][(frame - 1) % SAMPLES];
+}
+
+bool
+FrameProfiler::gpu_timing() const {
+    return m_gpu_timing;
+}
+
+const char*
+FrameProfiler::name(Phase phase) {
+    static const char* names[PHASES_COUNT] {
+        "update", "set states", "events", "tick", "sky", "chunks", "gui", "display"
+    };
+
+    return names[phase];
+}
+
+void
+FrameProfiler::init() {
+    initialized = true;
+
+    if (!sf::Context::isExtensionAvailable("GL_ARB_timer_query") &&
+            !sf::Context::isExtensionAvailable("GL_EXT_timer_query")) {
+        Logger::inst().log_debug("GL timer queries are not available.");
+        return;
+    }
+
+    gl_gen_queries        = reinterpret_cast<GenQueries>(sf::Context::getFunction("glGenQueries"));
+    gl_begin_query        = reinterpret_cast<BeginQuery>(sf::Context::getFunction("glBeginQuery"));
+    gl_end_query          = reinterpret_cast<EndQuery>(sf::Context::getFunction("glEndQuery"));
+    gl_get_query_objectiv = reinterpret_cast<GetQueryObjectiv>(
+        sf::Context::getFunction("glGetQueryObjectiv")
+    );
+    gl_get_query_objectui64v = reinterpret_cast<GetQueryObjectui64v>(
+        sf::Context::getFunction("glGetQueryObjectui64v")
+    );
+
+    if (!gl_get_query_objectui64v)
+        gl_get_query_objectui64v = reinterpret_cast<GetQueryObjectui64v>(
+            sf::Context::getFunction("glGetQueryObjectui64vEXT")
+        );
+
+    if (!gl_gen_queries || !gl_begin_query || !gl_end_query ||
+            !gl_get_query_objectiv || !gl_get_query_objectui64v) {
+        Logger::inst().log_debug("GL timer query functions can not be loaded.");
+        return;
+    }
+
+    gl_gen_queries(QUERY_FRAMES * PHASES_COUNT, &queries[0][0]);
+
+    m_gpu_timing = true;
+}
+
+void
+FrameProfiler::collect_gpu(int slot, int sample) {
+    for (int i = 0; i < PHASES_COUNT; i++) {
+        gpu_samples[i][sample] = 0.0f;
+
+        // A phase that didn't run this frame took no GPU time
+        gpu_valid[i][sample] = !queries_used[slot][i];
+
+        if (!queries_used[slot][i])
+            continue;
+
+        GLint available = 0;
+
+        gl_get_query_objectiv(queries[slot][i], GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (available) {
+            gpu_valid[i][sample] = true;
+
+            std::uint64_t nanoseconds = 0;
+
+            gl_get_query_objectui64v(queries[slot][i], GL_QUERY_RESULT, &nanoseconds);
+
+            gpu_samples[i][sample] = nanoseconds / 1000000.0f;
+        }
+
+        queries_used[slot][i] = false;
+    }
+}
+
+void
+FrameProfiler::log() {
+    std::string line = "Frame phases, avg/max ms:";
+
+    for (int i = 0; i < PHASES_COUNT; i++) {
+        Timing phase = timing(static_cast<Phase>(i));
+
+        line += fmt(" %s %.2f/%.2f", name(static_cast<Phase>(i)), phase.cpu_avg, phase.cpu_max);
+
+        if (m_gpu_timing)
+            line += fmt(" (gpu %.2f/%.2f)", phase.gpu_avg, phase.gpu_max);
+
+        line += i + 1 < PHASES_COUNT ? "," : ".";
+    }
+
+    Logger::inst().log_debug(line);
+}
+
+}
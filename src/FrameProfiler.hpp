@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+
+namespace mazemaze {
+
+// Per-phase frame timings: CPU time always, GPU time through timer queries
+// when the driver has them. Keeps rolling averages and maxima over the
+// last SAMPLES frames.
+class FrameProfiler {
+public:
+    enum Phase {
+        UPDATE,
+        SET_STATES,
+        HANDLE_EVENTS,
+        TICK,
+        SKY,
+        CHUNKS,
+        GUI,
+        DISPLAY,
+        PHASES_COUNT
+    };
+
+    struct Timing {
+        float cpu_avg;
+        float cpu_max;
+        float gpu_avg;
+        float gpu_max;
+    };
+
+    void begin(Phase phase);
+    void end(Phase phase);
+    void end_frame();
+    void reset();
+
+    // Phases timed on another thread's context can't share its queries
+    void set_cpu_only(bool cpu_only);
+
+    Timing timing(Phase phase) const;
+
+    // GPU time of the last collected frame in milliseconds, without the
+    // buffer swap that may wait for V-Sync
+    float  last_gpu_frame() const;
+    // CPU time of a phase in the last finished frame in milliseconds
+    float  last_cpu(Phase phase) const;
+    bool   gpu_timing() const;
+
+    static const char* name(Phase phase);
+
+    FrameProfiler(FrameProfiler const&) = delete;
+    void operator= (FrameProfiler const&) = delete;
+
+    static FrameProfiler& inst() {
+        static FrameProfiler instance;
+        return instance;
+    }
+
+private:
+    FrameProfiler();
+    ~FrameProfiler();
+
+    static const int SAMPLES = 120;
+    static const int QUERY_FRAMES = 4;
+
+    using clock = std::chrono::steady_clock;
+
+    bool initialized;
+    bool cpu_only;
+    bool m_gpu_timing;
+
+    clock::time_point starts[PHASES_COUNT];
+    clock::time_point last_log;
+
+    float cpu_frame[PHASES_COUNT];
+    float cpu_samples[PHASES_COUNT][SAMPLES];
+    float gpu_samples[PHASES_COUNT][SAMPLES];
+    // False where a query result wasn't ready, those are left out
+    bool  gpu_valid[PHASES_COUNT][SAMPLES];
+
+    unsigned int queries[QUERY_FRAMES][PHASES_COUNT];
+    bool queries_used[QUERY_FRAMES][PHASES_COUNT];
+
+    int frame;
+
+    void init();
+    void collect_gpu(int slot, int sample);
+    void log();
+};
+
+}
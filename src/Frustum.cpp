@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Frustum.hpp"
+
+#include <cmath>
+
+namespace mazemaze {
+
+Frustum::Frustum(Pointf position, Rotation rotation,
+                 double fov, double ratio, double near_dist, double far_dist) :
+        near_dist(near_dist) {
+    auto h_tan = static_cast<float>(std::tan(fov * (M_PI / 360.0)));
+    auto v_tan = static_cast<float>(h_tan / ratio);
+
+    Pointf normals[6] {
+        Pointf( 1.0f,  0.0f, -h_tan),
+        Pointf(-1.0f,  0.0f, -h_tan),
+        Pointf( 0.0f,  1.0f, -v_tan),
+        Pointf( 0.0f, -1.0f, -v_tan),
+        Pointf( 0.0f,  0.0f, -1.0f),
+        Pointf( 0.0f,  0.0f,  1.0f)
+    };
+
+    float distances[6] {
+        0.0f, 0.0f, 0.0f, 0.0f,
+        static_cast<float>(-near_dist),
+        static_cast<float>( far_dist)
+    };
+
+    for (int i = 0; i < 6; i++) {
+        Pointf normal = rotate(normals[i], rotation);
+
+        planes[i].normal   = normal;
+        planes[i].distance = distances[i] - (normal.x * position.x +
+                                             normal.y * position.y +
+                                             normal.z * position.z);
+    }
+}
+
+Frustum::~Frustum() = default;
+
+bool
+Frustum::intersects(Pointf min, Pointf max) const {
+    for (const auto& plane : planes) {
+        const Pointf& n = plane.normal;
+
+        float distance = n.x * (n.x >= 0.0f ? max.x : min.x) +
+                         n.y * (n.y >= 0.0f ? max.y : min.y) +
+                         n.z * (n.z >= 0.0f ? max.z : min.z) +
+                         plane.distance;
+
+        if (distance < 0.0f)
+            return false;
+    }
+
+    return true;
+}
+
+float
+Frustum::depth(Pointf min, Pointf max) const {
+    // Nearest distance from the eye plane, which is what GL_FOG uses
+    const Plane& plane = planes[4];
+    const Pointf& n = plane.normal;
+
+    return n.x * (n.x >= 0.0f ? min.x : max.x) +
+           n.y * (n.y >= 0.0f ? min.y : max.y) +
+           n.z * (n.z >= 0.0f ? min.z : max.z) +
+           plane.distance + near_dist;
+}
+
+Pointf
+Frustum::rotate(Pointf v, Rotation rotation) {
+    // Inverse of the camera rotation, i.e. eye space to world space
+    float s = std::sin(-rotation.pitch());
+    float c = std::cos(-rotation.pitch());
+
+    v = Pointf(v.x, v.y * c - v.z * s, v.y * s + v.z * c);
+
+    s = std::sin(-rotation.yaw());
+    c = std::cos(-rotation.yaw());
+
+    v = Pointf(v.x * c + v.z * s, v.y, -v.x * s + v.z * c);
+
+    s = std::sin(-rotation.roll());
+    c = std::cos(-rotation.roll());
+
+    return Pointf(v.x * c - v.y * s, v.x * s + v.y * c, v.z);
+}
+
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Point.hpp"
+#include "Rotation.hpp"
+
+namespace mazemaze {
+
+class Frustum {
+public:
+    explicit Frustum(Pointf position, Rotation rotation,
+                     double fov, double ratio, double near_dist, double far_dist);
+    ~Frustum();
+
+    bool  intersects(Pointf min, Pointf max) const;
+    float depth(Pointf min, Pointf max) const;
+
+private:
+    struct Plane {
+        Pointf normal;
+        float distance;
+    };
+
+    Plane planes[6];
+    float near_dist;
+
+    static Pointf rotate(Pointf vector, Rotation rotation);
+};
+
+}
@@ -17,17 +17,21 @@
 
 #include "Game.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
 #include <SFML/OpenGL.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include "FrameProfiler.hpp"
+#include "GlState.hpp"
 #include "GraphicEngine.hpp"
 #include "Saver.hpp"
 #include "Settings.hpp"
 #include "Logger.hpp"
 #include "MazeRenderer.hpp"
+#include "utils.hpp"
 
 #include "Gui/MainMenu.hpp"
 
@@ -39,9 +43,30 @@
 #include "MazeRenderers/Gray.hpp"
 #include "MazeRenderers/Brick.hpp"
 #include "MazeRenderers/NightBrick.hpp"
+#include "MazeRenderers/Raycast.hpp"
 
 namespace mazemaze {
 
+// Simulation runs at a fixed rate independent from the frame rate, the
+// camera is interpolated between the last two steps for rendering
+const float tick_time      = 1.0f / 60.0f;
+const float max_frame_time = 0.25f;
+
+RenderSnapshot::RenderSnapshot(const Camera& camera) :
+        camera(camera),
+        position(0.0f, 0.0f, 0.0f),
+        move_vector(0.0f, 0.0f),
+        time(0.0f),
+        delta_time(0.0f),
+        loaded(false),
+        paused(false),
+        won(false),
+        minimap_zoom(false),
+        renderer(0),
+        baked_lighting(false),
+        chunk_cache_size(0),
+        inactive_cache_size(0) {}
+
 Game::Game(
     gui::MainMenu& main_menu,
     Settings& settings,
@@ -50,32 +75,45 @@ Game::Game(
 ) :
         gui::Background(this, this, nullptr),
         m_maze(maze_size),
+        minimap(m_maze),
         maze_renderer(0),
         maze_renderers{nullptr},
         m_player(Pointf(1.5f, 0.0f, 1.5f)),
         m_settings(settings),
         saver(saver),
+        snapshots{ RenderSnapshot(m_player.camera()), RenderSnapshot(m_player.camera()) },
+        shown_snapshot(0),
+        minimap_zoom(false),
         main_menu(main_menu),
         paused(false),
         won(false),
         old_pause_key_state(false),
+        old_minimap_key_state(false),
         m_time(0.0f),
+        accumulator(0.0f),
         loaded(false) {
     Logger::inst().log_debug("Constructor of Game called.");
 
     saver.set_game(*this);
 
+    // Styles make their GL objects right away
+    GraphicEngine::inst().acquire_context();
+
     maze_renderers[0] = new renderers::Classic(*this);
     maze_renderers[1] = new renderers::Gray(*this);
     maze_renderers[2] = new renderers::Brick(*this);
     maze_renderers[3] = new renderers::NightBrick(*this);
+    maze_renderers[4] = new renderers::Raycast(*this);
 
     maze_renderers[maze_renderer]->enable();
+    maze_renderers[maze_renderer]->activate();
 
-    tickable_handler.addTickable(maze_renderers[maze_renderer]);
     tickable_handler.addTickable(&m_player);
 
     open_gui();
+
+    capture(0.0f);
+    sync();
 }
 
 Game::~Game() {
@@ -84,11 +122,29 @@ Game::~Game() {
     main_menu.remove_state(won_state);
     main_menu.remove_state(pause_state);
 
-    maze_renderers[maze_renderer]->disable();
+    if (!recording_path.empty()) {
+        recording.set_maze(m_maze.seed(), Point2i((m_maze.size().x - 1) / 2,
+                                                  (m_maze.size().y - 1) / 2));
+
+        if (recording.save(recording_path))
+            Logger::inst().log_status(fmt("Saved %d recorded frames to %s.",
+                                          static_cast<int>(recording.frames().size()),
+                                          recording_path.c_str()));
+        else
+            Logger::inst().log_error(fmt("Can not save recording to %s.",
+                                         recording_path.c_str()));
+    }
+
+    // The scene pass may still be drawing us
+    GraphicEngine::inst().acquire_context();
 
     for (int i = 0; i < 16; i++)
-        if (maze_renderers[i] != nullptr)
+        if (maze_renderers[i] != nullptr) {
+            if (maze_renderers[i]->enabled())
+                maze_renderers[i]->disable();
+
             delete maze_renderers[i];
+        }
 }
 
 void
@@ -126,23 +182,79 @@ Game::tick(void*, float deltaTime) {
 
     old_pause_key_state = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Escape);
 
-    sf::RenderWindow& window = graphic_engine.window();
-    window.setMouseCursorVisible(paused || won);
+    bool minimap_key_state = sf::Keyboard::isKeyPressed(m_settings.key("minimap"));
 
-    set_renderer(m_settings.renderer());
+    if (!minimap_key_state && old_minimap_key_state && graphic_engine.has_focus())
+        minimap_zoom = true;
 
-    tickable_handler.tick(*this, deltaTime);
+    old_minimap_key_state = minimap_key_state;
+
+    sf::RenderWindow& window = graphic_engine.window();
+    window.setMouseCursorVisible(paused || won);
 
     if (!(paused || won)) {
-        if (m_time - saver.last_save_time() >= m_settings.autosave_time() && m_settings.autosave())
-            saver.save();
+        m_player.look(m_settings);
+
+        // Long frames are not caught up in full so a hitch doesn't turn
+        // into a burst of simulation work
+        accumulator += std::min(deltaTime, max_frame_time);
 
-        if (    static_cast<int>(m_player.position().x) == m_maze.exit().x &&
-                static_cast<int>(m_player.position().z) == m_maze.exit().y)
-            set_won(true);
+        while (accumulator >= tick_time && !(paused || won)) {
+            step();
+            accumulator -= tick_time;
+        }
 
-        m_time += deltaTime;
+        m_player.interpolate(accumulator / tick_time);
     }
+
+    capture(deltaTime);
+}
+
+void
+Game::capture(float delta_time) {
+    RenderSnapshot& frame = snapshots[1 - shown_snapshot];
+
+    frame.camera              = m_player.camera();
+    frame.position            = m_player.position();
+    frame.move_vector         = m_player.move_vector();
+    frame.time                = m_time;
+    frame.delta_time          = delta_time;
+    frame.loaded              = loaded;
+    frame.paused              = paused;
+    frame.won                 = won;
+    frame.minimap_zoom        = minimap_zoom;
+    frame.renderer            = m_settings.renderer();
+    frame.baked_lighting      = m_settings.baked_lighting();
+    frame.chunk_cache_size    = m_settings.chunk_cache_size();
+    frame.inactive_cache_size = m_settings.inactive_cache_size();
+
+    minimap_zoom = false;
+}
+
+void
+Game::step() {
+    tickable_handler.tick(*this, tick_time);
+
+    if (!recording_path.empty())
+        recording.add(m_player.position(), m_player.camera().rotation(), tick_time);
+
+    if (m_time - saver.last_save_time() >= m_settings.autosave_time() && m_settings.autosave())
+        saver.save();
+
+    if (    static_cast<int>(m_player.position().x) == m_maze.exit().x &&
+            static_cast<int>(m_player.position().z) == m_maze.exit().y)
+        set_won(true);
+
+    m_time += tick_time;
+}
+
+void
+Game::tick_renderers(float delta_time) {
+    maze_renderers[maze_renderer]->tick(*this, delta_time);
+
+    for (int i = 0; i < 16; i++)
+        if (i != maze_renderer && maze_renderers[i] != nullptr && maze_renderers[i]->enabled())
+            maze_renderers[i]->idle_tick(*this, delta_time);
 }
 
 void
@@ -166,20 +278,49 @@ Game::stop() {
 
 void
 Game::render() {
+    const RenderSnapshot& frame = snapshot();
+
+    // Styles own GL objects, so they are switched and ticked here, on
+    // whichever thread draws the scene
+    set_renderer(frame.renderer, frame.inactive_cache_size);
+    tick_renderers(frame.delta_time);
+
+    if (frame.minimap_zoom)
+        minimap.zoom();
+
+    Camera camera = frame.camera;
+
+    if (frame.loaded)
+        minimap.tick(camera.position());
+
+    GraphicEngine& graphic_engine = GraphicEngine::inst();
+
+    graphic_engine.begin_maze_pass();
+
     glPushMatrix();
 
-    m_player.camera().setup_perspective();
+    camera.setup_perspective();
 
-    m_player.camera().setup_rotation();
+    FrameProfiler& profiler = FrameProfiler::inst();
+
+    profiler.begin(FrameProfiler::SKY);
+    camera.setup_rotation();
     maze_renderers[maze_renderer]->render_sky();
+    profiler.end(FrameProfiler::SKY);
 
-    m_player.camera().setup_translation();
-    maze_renderers[maze_renderer]->render();
+    profiler.begin(FrameProfiler::CHUNKS);
+    camera.setup_translation();
+    maze_renderers[maze_renderer]->render(camera);
+    profiler.end(FrameProfiler::CHUNKS);
 
     glPopMatrix();
 
-    if (paused || won) {
-        glDisable(GL_DEPTH_TEST);
+    graphic_engine.end_maze_pass();
+
+    minimap.render(camera.position(), camera.rotation().yaw());
+
+    if (frame.paused || frame.won) {
+        GlState::inst().disable(GL_DEPTH_TEST);
 
         glBegin(GL_QUADS);
 
@@ -195,10 +336,15 @@ Game::render() {
 
         glEnd();
 
-        glDisable(GL_DEPTH_TEST);
+        GlState::inst().disable(GL_DEPTH_TEST);
     }
 }
 
+void
+Game::sync() {
+    shown_snapshot = 1 - shown_snapshot;
+}
+
 void
 Game::set_paused(bool paused) {
     if (Game::paused != paused && !(paused && Game::won)) {
@@ -220,16 +366,32 @@ Game::set_paused(bool paused) {
 }
 
 void
-Game::set_renderer(int id) {
+Game::set_renderer(int id, unsigned int inactive_cache_size) {
     if (id != maze_renderer) {
-        maze_renderers[maze_renderer]->disable();
-        tickable_handler.removeTickable(maze_renderers[maze_renderer]);
+        MazeRenderer* old_renderer = maze_renderers[maze_renderer];
+
+        // Inactive styles keep their chunks within their own budget, so
+        // switching back is only a pointer swap
+        old_renderer->deactivate();
+
+        if (inactive_cache_size == 0)
+            old_renderer->disable();
+
         maze_renderer = id;
-        tickable_handler.addTickable(maze_renderers[maze_renderer]);
-        maze_renderers[maze_renderer]->enable();
+
+        if (!maze_renderers[maze_renderer]->enabled())
+            maze_renderers[maze_renderer]->enable();
+
+        maze_renderers[maze_renderer]->activate();
     }
 }
 
+void
+Game::record(const std::string& path) {
+    recording_path = path;
+    recording.clear();
+}
+
 void
 Game::set_won(bool won) {
     if (Game::won != won) {
@@ -267,6 +429,11 @@ Game::time() const {
     return m_time;
 }
 
+const RenderSnapshot&
+Game::snapshot() const {
+    return snapshots[shown_snapshot];
+}
+
 Maze&
 Game::maze() {
     return m_maze;
@@ -287,6 +454,28 @@ Game::settings() const {
     return m_settings;
 }
 
+MazeRenderer&
+Game::renderer() const {
+    return *maze_renderers[maze_renderer];
+}
+
+// Styles are made once in the constructor, so this doesn't race with the
+// render thread switching between them
+const char*
+Game::renderer_name(int id) const {
+    return maze_renderers[id]->name();
+}
+
+int
+Game::renderers_count() const {
+    int count = 0;
+
+    while (count < 16 && maze_renderers[count] != nullptr)
+        count++;
+
+    return count;
+}
+
 unsigned int
 Game::gen_seed() {
     using namespace std::chrono;
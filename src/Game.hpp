@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2018-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -17,9 +17,14 @@
 
 #pragma once
 
+#include <string>
+
 #include "Gui/Background.hpp"
 
+#include "Camera.hpp"
+#include "CameraPath.hpp"
 #include "Maze.hpp"
+#include "Minimap.hpp"
 #include "Player.hpp"
 #include "IRenderable.hpp"
 #include "ITickable.hpp"
@@ -32,11 +37,31 @@ class MainMenu;
 
 }
 
-class Camera;
 class Settings;
 class MazeRenderer;
 class Saver;
 
+// Everything the scene pass reads from the simulation. Game fills one copy
+// at the end of each tick while the other is drawn, so with a render thread
+// the next frame can be simulated while the last one is still submitted.
+struct RenderSnapshot {
+    explicit RenderSnapshot(const Camera& camera);
+
+    Camera  camera;
+    Pointf  position;
+    Point2f move_vector;
+    float   time;
+    float   delta_time;
+    bool    loaded;
+    bool    paused;
+    bool    won;
+    bool    minimap_zoom;
+    int     renderer;
+    bool    baked_lighting;
+    unsigned int chunk_cache_size;
+    unsigned int inactive_cache_size;
+};
+
 class Game : public gui::Background {
 public:
     explicit Game(
@@ -52,33 +77,44 @@ public:
     void on_load();
 
     void render() override;
+    void sync() override;
     void tick(void*, float delta_time) override;
+    void capture(float delta_time);
+    void tick_renderers(float delta_time);
     void open_gui();
     void stop();
 
     void set_paused(bool paused);
     void set_won(bool won);
     void set_time(float time);
-    void set_renderer(int id);
+    void set_renderer(int id, unsigned int inactive_cache_size);
+    void record(const std::string& path);
 
     bool is_paused() const;
     bool is_won() const;
     bool is_loaded() const;
 
     float         time() const;
+    const RenderSnapshot& snapshot() const;
     Maze&         maze();
     Player&       player();
     Camera*       camera() override;
     MazeRenderer& renderer() const;
+    const char*   renderer_name(int id) const;
+    int           renderers_count() const;
     Settings&     settings() const;
 
 private:
     Maze m_maze;
+    Minimap minimap;
     int maze_renderer;
     MazeRenderer* maze_renderers[16];
     Player m_player;
     Settings& m_settings;
     Saver& saver;
+    RenderSnapshot snapshots[2];
+    int shown_snapshot;
+    bool minimap_zoom;
     TickableHandler<Game&> tickable_handler;
 
     gui::MainMenu& main_menu;
@@ -89,9 +125,15 @@ private:
     bool  paused;
     bool  won;
     bool  old_pause_key_state;
+    bool  old_minimap_key_state;
     float m_time;
+    float accumulator;
     bool  loaded;
 
+    CameraPath  recording;
+    std::string recording_path;
+
+    void step();
     unsigned int gen_seed();
 };
 
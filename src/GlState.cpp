@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GlState.hpp"
+
+#include <algorithm>
+
+#include "GraphicEngine.hpp"
+
+namespace mazemaze {
+
+GlState::GlState() = default;
+
+GlState::~GlState() = default;
+
+void
+GlState::enable(GLenum cap) {
+    set_cap(cap, true);
+}
+
+void
+GlState::disable(GLenum cap) {
+    set_cap(cap, false);
+}
+
+void
+GlState::light(GLenum light, GLenum pname, const float* params) {
+    if (pname == GL_POSITION || pname == GL_SPOT_DIRECTION) {
+        glLightfv(light, pname, params);
+        return;
+    }
+
+    if (update(Key(light, pname), params, params_count(pname)))
+        glLightfv(light, pname, params);
+}
+
+void
+GlState::light(GLenum light, GLenum pname, float param) {
+    if (update(Key(light, pname), &param, 1))
+        glLightf(light, pname, param);
+}
+
+void
+GlState::light_model(GLenum pname, const float* params) {
+    if (update(Key(GL_LIGHTING, pname), params, params_count(pname)))
+        glLightModelfv(pname, params);
+}
+
+void
+GlState::fog(GLenum pname, const float* params) {
+    if (update(Key(GL_FOG, pname), params, params_count(pname)))
+        glFogfv(pname, params);
+}
+
+void
+GlState::fog(GLenum pname, float param) {
+    if (update(Key(GL_FOG, pname), &param, 1))
+        glFogf(pname, param);
+}
+
+void
+GlState::fog(GLenum pname, int param) {
+    float value = static_cast<float>(param);
+
+    if (update(Key(GL_FOG, pname), &value, 1))
+        glFogi(pname, param);
+}
+
+void
+GlState::invalidate_caps() {
+    caps.clear();
+}
+
+void
+GlState::invalidate() {
+    caps.clear();
+    params.clear();
+}
+
+void
+GlState::set_cap(GLenum cap, bool enabled) {
+    auto it = caps.find(cap);
+
+    if (it != caps.end() && it->second == enabled) {
+        count_saved();
+        return;
+    }
+
+    caps[cap] = enabled;
+
+    if (enabled)
+        glEnable(cap);
+    else
+        glDisable(cap);
+}
+
+bool
+GlState::update(Key key, const float* values, int count) {
+    auto it = params.find(key);
+
+    if (it != params.end() && std::equal(values, values + count, it->second.begin())) {
+        count_saved();
+        return false;
+    }
+
+    std::array<float, 4>& cached = params[key];
+
+    std::copy(values, values + count, cached.begin());
+
+    return true;
+}
+
+void
+GlState::count_saved() {
+    GraphicEngine::inst().stats().saved_state_calls++;
+}
+
+int
+GlState::params_count(GLenum pname) {
+    switch (pname) {
+    case GL_AMBIENT:
+    case GL_DIFFUSE:
+    case GL_SPECULAR:
+    case GL_LIGHT_MODEL_AMBIENT:
+    case GL_FOG_COLOR:
+        return 4;
+
+    default:
+        return 1;
+    }
+}
+
+}
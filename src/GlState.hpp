@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <utility>
+
+#include <SFML/OpenGL.hpp>
+
+namespace mazemaze {
+
+// Shadows the fixed-function capabilities, light and fog parameters we set
+// and drops calls that wouldn't change anything. Every skipped call is
+// counted in RenderStats::saved_state_calls.
+//
+// Light positions are always passed through since GL transforms them by
+// the current modelview matrix.
+class GlState {
+public:
+    void enable (GLenum cap);
+    void disable(GLenum cap);
+
+    void light(GLenum light, GLenum pname, const float* params);
+    void light(GLenum light, GLenum pname, float param);
+
+    void light_model(GLenum pname, const float* params);
+
+    void fog(GLenum pname, const float* params);
+    void fog(GLenum pname, float param);
+    void fog(GLenum pname, int param);
+
+    // SFML and SFGUI toggle capabilities behind our back, parameters
+    // survive until the context is recreated
+    void invalidate_caps();
+    void invalidate();
+
+    GlState(GlState const&) = delete;
+    void operator= (GlState const&) = delete;
+
+    static GlState& inst() {
+        static GlState instance;
+        return instance;
+    }
+
+private:
+    typedef std::pair<GLenum, GLenum> Key;
+
+    std::map<GLenum, bool> caps;
+    std::map<Key, std::array<float, 4>> params;
+
+    GlState();
+    ~GlState();
+
+    void set_cap(GLenum cap, bool enabled);
+    bool update(Key key, const float* values, int count);
+    void count_saved();
+
+    static int params_count(GLenum pname);
+};
+
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GpuResources.hpp"
+
+#include <algorithm>
+
+#include <SFML/System/Clock.hpp>
+
+#include "Logger.hpp"
+#include "utils.hpp"
+
+namespace mazemaze {
+
+GpuResources::GpuResources() = default;
+
+GpuResources::~GpuResources() = default;
+
+int
+GpuResources::add(std::function<void ()> const& build, std::function<void ()> const& release) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    Resource resource { build, release, false };
+
+    if (free_ids.empty()) {
+        resources.push_back(resource);
+        return resources.size() - 1;
+    }
+
+    int id = free_ids.back();
+    free_ids.pop_back();
+
+    resources[id] = resource;
+
+    return id;
+}
+
+void
+GpuResources::remove(int id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    release(id);
+
+    resources[id] = Resource { nullptr, nullptr, false };
+    free_ids.push_back(id);
+}
+
+void
+GpuResources::ensure(int id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    Resource& resource = resources[id];
+
+    if (resource.built)
+        return;
+
+    // Set first, so a build that ensures itself doesn't recurse
+    resource.built = true;
+    resource.build();
+}
+
+void
+GpuResources::release(int id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    Resource& resource = resources[id];
+
+    // Released by the owner, so it isn't wanted back either
+    lost.erase(std::remove(lost.begin(), lost.end(), id), lost.end());
+
+    if (!resource.built)
+        return;
+
+    resource.built = false;
+    resource.release();
+}
+
+void
+GpuResources::lose() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    int count = 0;
+
+    // Objects shared with the new context are still valid, so releasing
+    // them frees what would otherwise leak
+    for (int id = 0; id < static_cast<int>(resources.size()); id++) {
+        if (!resources[id].built)
+            continue;
+
+        resources[id].built = false;
+        resources[id].release();
+
+        lost.push_back(id);
+
+        count++;
+    }
+
+    Logger::inst().log_debug(fmt("Context lost, %d GPU resources to rebuild.", count));
+}
+
+sf::Time
+GpuResources::frame_budget() {
+    return sf::milliseconds(1);
+}
+
+void
+GpuResources::rebuild(sf::Time time_budget) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    sf::Clock clock;
+
+    while (!lost.empty() && clock.getElapsedTime() < time_budget) {
+        int id = lost.front();
+        lost.pop_front();
+
+        // Owners that needed it earlier have already made it again
+        ensure(id);
+    }
+}
+
+}
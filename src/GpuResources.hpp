@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <SFML/System/Time.hpp>
+
+namespace mazemaze {
+
+// GL objects that have to be made again when the context they live in is
+// lost. Each one is registered with how to build and how to release it.
+// Owners call ensure() right before use; after a loss everything is
+// released at once and then rebuilt a few per frame, or earlier by its
+// owner if it's needed before its turn.
+class GpuResources {
+public:
+    int  add(std::function<void ()> const& build, std::function<void ()> const& release);
+    void remove(int id);
+
+    void ensure(int id);
+    void release(int id);
+
+    void lose();
+    void rebuild(sf::Time time_budget);
+
+    // Time a frame may spend on bringing resources back after a loss
+    static sf::Time frame_budget();
+
+    GpuResources(GpuResources const&) = delete;
+    void operator= (GpuResources const&) = delete;
+
+    static GpuResources& inst() {
+        static GpuResources instance;
+        return instance;
+    }
+
+private:
+    GpuResources();
+    ~GpuResources();
+
+    struct Resource {
+        std::function<void ()> build;
+        std::function<void ()> release;
+        bool built;
+    };
+
+    // Building one resource may ensure another, e.g. lists calling lists
+    std::recursive_mutex mutex;
+
+    std::vector<Resource> resources;
+    std::vector<int> free_ids;
+    std::deque<int> lost;
+};
+
+}
@@ -17,6 +17,7 @@
 
 #include "GraphicEngine.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 #ifdef _WIN32
@@ -28,6 +29,9 @@
 
 #include <SFGUI/Renderers.hpp>
 
+#include "FrameProfiler.hpp"
+#include "GlState.hpp"
+#include "GpuResources.hpp"
 #include "path_separator.hpp"
 #include "Logger.hpp"
 #include "utils.hpp"
@@ -36,6 +40,8 @@ namespace mazemaze {
 
 GraphicEngine::GraphicEngine() :
         m_window(nullptr),
+        m_offscreen(nullptr),
+        gui_layer(nullptr),
         old_window_pos(-1, -1),
         old_window_size(854, 480),
         icon_loaded(false),
@@ -43,9 +49,22 @@ GraphicEngine::GraphicEngine() :
         need_reopen_event(false),
         m_vsync(false),
         m_focus(true),
-        m_max_antialiasing(calc_max_antialiasing()),
+        m_fps_limit(0),
+        m_menu_fps_limit(60),
+        m_antialiasing(0),
+        m_max_antialiasing(0),
+        m_smooth_edges(false),
+        m_render_thread(false),
         icon(sf::Image()),
-        on_set_states([] () {}) {
+        maze_scale(1.0f),
+        maze_samples(0),
+        maze_smooth(false),
+        maze_pass_offscreen(false),
+        on_set_states([] () {}),
+        scene_pending(false),
+        scene_stopping(false),
+        scene_drawn(false),
+        context_owned(true) {
     auto icon_file = "data" PATH_SEPARATOR "icon.png";
 
     if (!(icon_loaded = icon.loadFromFile(icon_file))) {
@@ -58,7 +77,10 @@ GraphicEngine::GraphicEngine() :
     unwait_key();
 }
 
-GraphicEngine::~GraphicEngine() = default;
+GraphicEngine::~GraphicEngine() {
+    delete m_offscreen;
+    delete gui_layer;
+}
 
 void
 GraphicEngine::open_window() {
@@ -92,6 +114,9 @@ GraphicEngine::open_window(sf::VideoMode video_mode, bool fullscreen) {
 
     m_window = new sf::RenderWindow(video_mode, window_name, style, state, settings);
 
+    // New window, new context with default states
+    GlState::inst().invalidate();
+
     if (!fullscreen) {
         if (old_window_pos != sf::Vector2i(-1, -1))
             m_window->setPosition(old_window_pos);
@@ -108,12 +133,61 @@ GraphicEngine::open_window(sf::VideoMode video_mode, bool fullscreen) {
 
     settings = m_window->getSettings();
 
+    // Antialiasing is done by the scene target, so it's limited by what
+    // framebuffer objects support rather than by the window
+    m_max_antialiasing = scene_target.max_samples();
+
+    m_window_size = Point2i(m_window->getSize().x, m_window->getSize().y);
+    m_scene_size = m_window_size;
+
     if (icon_loaded)
         m_window->setIcon(icon.getSize(), icon.getPixelsPtr());
 
     set_vsync(m_vsync);
 }
 
+bool
+GraphicEngine::open_offscreen(Point2i size) {
+    Logger::inst().log_debug(fmt("Offscreen target opening. Size is %dx%d", size.x, size.y));
+
+    m_offscreen = new sf::RenderTexture();
+
+    // RenderTexture renders into an FBO, so no window is shown, but SFML
+    // still creates its context through the windowing system (GLX on
+    // Linux) and needs a display for it
+    if (!m_offscreen->resize(sf::Vector2u(size.x, size.y), settings) ||
+            !m_offscreen->setActive(true)) {
+        Logger::inst().log_error("Can not create offscreen render target.");
+
+        delete m_offscreen;
+        m_offscreen = nullptr;
+
+        return false;
+    }
+
+    GlState::inst().invalidate();
+
+    // Antialiasing is done by the scene target here as well
+    m_max_antialiasing = scene_target.max_samples();
+
+    m_window_size = size;
+    m_scene_size = size;
+
+    return true;
+}
+
+void
+GraphicEngine::render_offscreen(IRenderable& renderable) {
+    // There is no sync() between benchmark frames, the resolution stays
+    // fixed so runs are comparable
+    maze_samples = std::min(m_antialiasing, m_max_antialiasing);
+    maze_smooth  = m_smooth_edges;
+
+    render_scene(renderable);
+
+    m_offscreen->display();
+}
+
 void
 GraphicEngine::open_window(unsigned int width, unsigned int height, bool fullscreen) {
     sf::VideoMode video_mode = sf::VideoMode({width, height});
@@ -132,19 +206,26 @@ GraphicEngine::update() {
 
         open_window(video_mode, m_fullscreen);
 
+        FrameProfiler::inst().reset();
+        scene_target.reset();
+        GpuResources::inst().lose();
+
         need_reopen = false;
         need_reopen_event = true;
+        scene_drawn = false;
     }
 }
 
 void
 GraphicEngine::set_states() {
 //  Logger::inst().log_debug("Setting GL states.");
-    glEnable(GL_CULL_FACE);
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_BLEND);
-    glEnable(GL_NORMALIZE);
-    glEnable(GL_COLOR_MATERIAL);
+    GlState& gl_state = GlState::inst();
+
+    gl_state.enable(GL_CULL_FACE);
+    gl_state.enable(GL_DEPTH_TEST);
+    gl_state.enable(GL_BLEND);
+    gl_state.enable(GL_NORMALIZE);
+    gl_state.enable(GL_COLOR_MATERIAL);
     glLightModelf(GL_LIGHT_MODEL_TWO_SIDE, GL_FALSE);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glHint(GL_FOG_HINT, GL_FASTEST);
@@ -163,27 +244,286 @@ GraphicEngine::loop(sfg::SFGUI& sfgui, gui::MainMenu& main_menu) {
     sfgui.AddCharacterSet(0xC0,  0x100);
     sfgui.AddCharacterSet(0x400, 0x500);
 
+    FrameProfiler& profiler = FrameProfiler::inst();
+
     while (running) {
-        update();
-        set_states();
+        if (m_render_thread != scene_thread.joinable()) {
+            if (m_render_thread)
+                start_scene_thread(main_menu);
+            else
+                stop_scene_thread();
+        }
+
+        if (!scene_thread.joinable()) {
+            profiler.begin(FrameProfiler::UPDATE);
+            update();
+            profiler.end(FrameProfiler::UPDATE);
+        }
 
+        profiler.begin(FrameProfiler::HANDLE_EVENTS);
         handle_events(main_menu);
+        profiler.end(FrameProfiler::HANDLE_EVENTS);
 
+        profiler.begin(FrameProfiler::TICK);
         main_menu.tick(nullptr, frame_delta_time);
+        profiler.end(FrameProfiler::TICK);
 
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (scene_thread.joinable()) {
+            // Events and ticking overlapped the scene pass of the last
+            // frame, the GUI goes on top of it once it is done
+            acquire_context();
 
-        main_menu.render();
+            profiler.begin(FrameProfiler::UPDATE);
+            update();
+            profiler.end(FrameProfiler::UPDATE);
 
-        m_window->resetGLStates();
-        sfgui.Display(*m_window);
-        m_window->display();
+            if (!scene_drawn)
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+            render_gui(sfgui, main_menu);
+
+            sync(main_menu);
+            dispatch_scene();
+        } else {
+            sync(main_menu);
+            render_scene(main_menu);
+            render_gui(sfgui, main_menu);
+        }
+
+        // Menus and the pause screen have their own, usually lower, cap
+        // so they don't keep the GPU busy for nothing
+        pacer.set_limit(main_menu.state() == -1 ? m_fps_limit : m_menu_fps_limit);
+        pacer.wait();
 
         running &= !main_menu.wants_exit();
 
         frame_delta_time = delta_clock.getElapsedTime().asSeconds();
         delta_clock.restart();
     }
+
+    stop_scene_thread();
+}
+
+void
+GraphicEngine::sync(gui::MainMenu& main_menu) {
+    FrameProfiler& profiler = FrameProfiler::inst();
+
+    m_frame_stats = m_stats;
+    m_scene_size = m_window_size;
+
+    main_menu.sync();
+
+    profiler.end_frame();
+
+    // Only the measured work counts. The frame time also holds pacing and
+    // the V-Sync wait, so under a cap it never looks fast enough to scale
+    // back up.
+    float scene_work = profiler.last_cpu(FrameProfiler::SET_STATES) +
+                       profiler.last_cpu(FrameProfiler::SKY) +
+                       profiler.last_cpu(FrameProfiler::CHUNKS);
+    float main_work  = profiler.last_cpu(FrameProfiler::UPDATE) +
+                       profiler.last_cpu(FrameProfiler::HANDLE_EVENTS) +
+                       profiler.last_cpu(FrameProfiler::TICK) +
+                       profiler.last_cpu(FrameProfiler::GUI);
+
+    // With the render thread the scene overlaps the rest of the frame
+    float work = scene_thread.joinable() ? std::max(scene_work, main_work)
+                                         : scene_work + main_work;
+
+    if (profiler.gpu_timing())
+        work = std::max(work, profiler.last_gpu_frame());
+
+    unsigned int limit = pacer.limit() != 0 ? pacer.limit() : 60;
+
+    m_dynamic_resolution.tick(work / 1000.0f, 1.0f / limit);
+
+    maze_scale   = m_dynamic_resolution.scale();
+    maze_samples = std::min(m_antialiasing, m_max_antialiasing);
+    maze_smooth  = m_smooth_edges;
+}
+
+void
+GraphicEngine::render_scene(IRenderable& renderable) {
+    FrameProfiler& profiler = FrameProfiler::inst();
+
+    m_stats.saved_state_calls = 0;
+
+    profiler.begin(FrameProfiler::SET_STATES);
+    set_states();
+    profiler.end(FrameProfiler::SET_STATES);
+
+    m_stats.draw_calls = 0;
+    m_stats.resolution_scale = 1.0f;
+
+    // SFML sets the viewport only when the GUI is drawn
+    glViewport(0, 0, m_scene_size.x, m_scene_size.y);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // Whatever the renderable doesn't ask for this frame comes back here
+    GpuResources::inst().rebuild(GpuResources::frame_budget());
+
+    renderable.render();
+}
+
+void
+GraphicEngine::begin_maze_pass() {
+    float scale = maze_scale;
+
+    maze_pass_offscreen = (scale < 1.0f || maze_samples > 0 || maze_smooth) &&
+                          scene_target.supported();
+
+    if (!maze_pass_offscreen)
+        return;
+
+    scene_target.begin(maze_pass_size(), maze_samples);
+
+    m_stats.resolution_scale = scale;
+}
+
+Point2i
+GraphicEngine::maze_pass_size() const {
+    return Point2i(std::max(1, static_cast<int>(m_scene_size.x * maze_scale)),
+                   std::max(1, static_cast<int>(m_scene_size.y * maze_scale)));
+}
+
+void
+GraphicEngine::end_maze_pass() {
+    if (maze_pass_offscreen)
+        scene_target.end(m_scene_size, maze_smooth);
+}
+
+void
+GraphicEngine::render_gui(sfg::SFGUI& sfgui, gui::MainMenu& main_menu) {
+    FrameProfiler& profiler = FrameProfiler::inst();
+
+    profiler.begin(FrameProfiler::GUI);
+
+    // During gameplay without overlays there is nothing to draw, so the
+    // GL state reset SFML needs before drawing is skipped as well
+    if (main_menu.visible()) {
+        if (main_menu.dirty() || gui_layer == nullptr ||
+                gui_layer->getSize() != sf::Vector2u(m_window_size.x, m_window_size.y))
+            render_gui_layer(sfgui, main_menu);
+
+        // SFGUI blends into the transparent layer, so its colours come out
+        // already multiplied by alpha
+        sf::BlendMode premultiplied(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+
+        m_window->resetGLStates();
+        m_window->draw(sf::Sprite(gui_layer->getTexture()), premultiplied);
+        GlState::inst().invalidate_caps();
+    }
+
+    profiler.end(FrameProfiler::GUI);
+
+    profiler.begin(FrameProfiler::DISPLAY);
+    m_window->display();
+    profiler.end(FrameProfiler::DISPLAY);
+}
+
+void
+GraphicEngine::render_gui_layer(sfg::SFGUI& sfgui, gui::MainMenu& main_menu) {
+    sf::Vector2u size(m_window_size.x, m_window_size.y);
+
+    if (gui_layer == nullptr || gui_layer->getSize() != size) {
+        delete gui_layer;
+
+        gui_layer = new sf::RenderTexture();
+
+        if (!gui_layer->resize(size))
+            Logger::inst().log_error("Can not create GUI layer render texture.");
+    }
+
+    gui_layer->clear(sf::Color::Transparent);
+    sfgui.Display(*gui_layer);
+    gui_layer->display();
+
+    main_menu.validate();
+}
+
+void
+GraphicEngine::dispatch_scene() {
+    m_window->setActive(false);
+    context_owned = false;
+
+    {
+        std::lock_guard<std::mutex> lock(scene_mutex);
+        scene_pending = true;
+    }
+
+    scene_cv.notify_all();
+    scene_drawn = true;
+}
+
+void
+GraphicEngine::start_scene_thread(gui::MainMenu& main_menu) {
+    Logger::inst().log_debug("Starting render thread.");
+
+    scene_pending = false;
+    scene_stopping = false;
+    scene_drawn = false;
+
+    // GPU queries belong to the context of one thread, and the frame is
+    // now split between two
+    FrameProfiler::inst().set_cpu_only(true);
+
+    scene_thread = std::thread([this, &main_menu] () {
+        std::unique_lock<std::mutex> lock(scene_mutex);
+
+        for (;;) {
+            scene_cv.wait(lock, [this] () { return scene_pending || scene_stopping; });
+
+            if (scene_stopping)
+                break;
+
+            lock.unlock();
+
+            m_window->setActive(true);
+            render_scene(main_menu);
+            m_window->setActive(false);
+
+            lock.lock();
+
+            scene_pending = false;
+            scene_cv.notify_all();
+        }
+    });
+}
+
+void
+GraphicEngine::stop_scene_thread() {
+    if (!scene_thread.joinable())
+        return;
+
+    Logger::inst().log_debug("Stopping render thread.");
+
+    acquire_context();
+
+    {
+        std::lock_guard<std::mutex> lock(scene_mutex);
+        scene_stopping = true;
+    }
+
+    scene_cv.notify_all();
+    scene_thread.join();
+
+    FrameProfiler::inst().set_cpu_only(false);
+}
+
+void
+GraphicEngine::acquire_context() {
+    if (!scene_thread.joinable())
+        return;
+
+    {
+        std::unique_lock<std::mutex> lock(scene_mutex);
+        scene_cv.wait(lock, [this] () { return !scene_pending; });
+    }
+
+    if (!context_owned) {
+        m_window->setActive(true);
+        context_owned = true;
+    }
 }
 
 void
@@ -220,31 +560,43 @@ GraphicEngine::set_fullscreen(bool fullscreen) {
 
 void
 GraphicEngine::set_antialiasing(unsigned int antialiasing) {
-    if (antialiasing != settings.antiAliasingLevel) {
-        if (m_window != nullptr) {
-            old_window_pos = m_window->getPosition();
-#ifdef _WIN32
-            update_old_maximized();
-#endif
-
-            if (m_fullscreen)
-                video_mode = sf::VideoMode::getDesktopMode();
-            else
-                video_mode = sf::VideoMode(m_window->getSize());
-
-            need_reopen = true;
-        }
-
-        settings.antiAliasingLevel = antialiasing;
-    }
+    // Only the scene target changes, the window and its context stay
+    m_antialiasing = antialiasing;
 }
 
 void
 GraphicEngine::set_vsync(bool vsync) {
     GraphicEngine::m_vsync = vsync;
 
-    if (m_window != nullptr)
+    if (m_window != nullptr) {
+        acquire_context();
         m_window->setVerticalSyncEnabled(vsync);
+    }
+}
+
+void
+GraphicEngine::set_fps_limit(unsigned int fps_limit) {
+    m_fps_limit = fps_limit;
+}
+
+void
+GraphicEngine::set_menu_fps_limit(unsigned int menu_fps_limit) {
+    m_menu_fps_limit = menu_fps_limit;
+}
+
+void
+GraphicEngine::set_render_thread(bool render_thread) {
+    m_render_thread = render_thread;
+}
+
+void
+GraphicEngine::set_smooth_edges(bool smooth_edges) {
+    m_smooth_edges = smooth_edges;
+}
+
+void
+GraphicEngine::set_dynamic_resolution(bool dynamic_resolution) {
+    m_dynamic_resolution.set_enabled(dynamic_resolution);
 }
 
 void
@@ -257,11 +609,26 @@ GraphicEngine::window() {
     return *m_window;
 }
 
+RenderStats&
+GraphicEngine::stats() {
+    return m_stats;
+}
+
+const RenderStats&
+GraphicEngine::frame_stats() const {
+    return m_frame_stats;
+}
+
 Point2i
 GraphicEngine::window_size() const {
     return m_window_size;
 }
 
+Point2i
+GraphicEngine::scene_size() const {
+    return m_scene_size;
+}
+
 unsigned int
 GraphicEngine::max_antialiasing() const {
     return m_max_antialiasing;
@@ -277,28 +644,44 @@ GraphicEngine::vsync() const {
     return m_vsync;
 }
 
+unsigned int
+GraphicEngine::fps_limit() const {
+    return m_fps_limit;
+}
+
+unsigned int
+GraphicEngine::menu_fps_limit() const {
+    return m_menu_fps_limit;
+}
+
 bool
-GraphicEngine::has_focus() const {
-    return m_focus;
+GraphicEngine::render_thread() const {
+    return m_render_thread;
 }
 
 unsigned int
-GraphicEngine::calc_max_antialiasing() {
-    sf::ContextSettings settings;
-    sf::VideoMode video_mode = sf::VideoMode({16, 16});
-    uint32_t style = sf::Style::None;
-    sf::State state = sf::State::Windowed;
-    settings.antiAliasingLevel = 16;
+GraphicEngine::antialiasing() const {
+    return m_antialiasing;
+}
 
-    sf::RenderWindow win(video_mode, sf::String(), style, state, settings);
+bool
+GraphicEngine::smooth_edges() const {
+    return m_smooth_edges;
+}
 
-    settings = win.getSettings();
-    win.close();
+bool
+GraphicEngine::dynamic_resolution() const {
+    return m_dynamic_resolution.enabled();
+}
 
-    Logger::inst().log_debug(fmt("Calculated max antialiasing is %d.",
-                                 settings.antiAliasingLevel));
+bool
+GraphicEngine::has_focus() const {
+    return m_focus;
+}
 
-    return settings.antiAliasingLevel;
+bool
+GraphicEngine::headless() const {
+    return m_offscreen != nullptr;
 }
 
 #ifdef _WIN32
@@ -319,6 +702,9 @@ GraphicEngine::handle_events(gui::MainMenu& main_menu) {
         if (!event.has_value())
             break;
 
+        if (const auto* resized = event->getIf<sf::Event::Resized>())
+            m_window_size = Point2i(resized->size.x, resized->size.y);
+
         main_menu.handle_event(*event);
 
         if (event->is<sf::Event::Closed>()) {
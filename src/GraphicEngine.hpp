@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <functional>
+#include <mutex>
+#include <thread>
 
 #include <SFML/Graphics.hpp>
 
@@ -25,11 +28,19 @@
 
 #include "Gui/MainMenu.hpp"
 
+#include "DynamicResolution.hpp"
+#include "FramePacer.hpp"
+#include "IRenderable.hpp"
+#include "RenderStats.hpp"
+#include "SceneTarget.hpp"
+
 namespace mazemaze {
 
 class GraphicEngine {
 public:
     void open_window();
+    bool open_offscreen(Point2i size);
+    void render_offscreen(IRenderable& renderable);
 
     void loop(sfg::SFGUI& sfgui, gui::MainMenu& main_menu);
     void wait_key(std::function<void (const sf::Keyboard::Key)> const& onKey);
@@ -38,14 +49,42 @@ public:
     void set_fullscreen(bool fullscreen);
     void set_antialiasing(unsigned int antialiasing);
     void set_vsync(bool vsync);
+    void set_fps_limit(unsigned int fps_limit);
+    void set_menu_fps_limit(unsigned int menu_fps_limit);
+    void set_render_thread(bool render_thread);
+    void set_smooth_edges(bool smooth_edges);
+    void set_dynamic_resolution(bool dynamic_resolution);
     void set_on_set_states_callback(std::function<void ()> const& on_set_states);
 
+    // Waits for the scene pass to finish and makes the GL context current
+    // on the main thread. GL work outside of rendering goes through here.
+    void acquire_context();
+
+    // The maze is drawn between these, at a lower resolution when frames
+    // run late
+    void begin_maze_pass();
+    void end_maze_pass();
+
+    // Size the maze is drawn at this frame, the scene size scaled down by
+    // dynamic resolution
+    Point2i maze_pass_size() const;
+
     sf::RenderWindow& window();
+    RenderStats&      stats();
+    const RenderStats& frame_stats() const;
     Point2i           window_size() const;
+    Point2i           scene_size() const;
+    unsigned int      antialiasing() const;
     unsigned int      max_antialiasing() const;
+    bool              smooth_edges() const;
     bool              fullscreen() const;
     bool              vsync() const;
+    unsigned int      fps_limit() const;
+    unsigned int      menu_fps_limit() const;
+    bool              render_thread() const;
+    bool              dynamic_resolution() const;
     bool              has_focus() const;
+    bool              headless() const;
 
     GraphicEngine(GraphicEngine const&) = delete;
     void operator= (GraphicEngine const&) = delete;
@@ -60,6 +99,8 @@ private:
     ~GraphicEngine();
 
     sf::RenderWindow* m_window;
+    sf::RenderTexture* m_offscreen;
+    sf::RenderTexture* gui_layer;
 
     sf::Vector2i old_window_pos;
     sf::Vector2u old_window_size;
@@ -68,6 +109,7 @@ private:
 #endif
 
     Point2i m_window_size;
+    Point2i m_scene_size;
     bool icon_loaded;
     bool running;
     bool need_reopen;
@@ -75,20 +117,50 @@ private:
     bool m_fullscreen;
     bool m_vsync;
     bool m_focus;
+    unsigned int m_fps_limit;
+    unsigned int m_menu_fps_limit;
+    unsigned int m_antialiasing;
     unsigned int m_max_antialiasing;
+    bool m_smooth_edges;
+    bool m_render_thread;
     sf::ContextSettings settings;
     sf::VideoMode video_mode;
 
     sf::Image icon;
 
+    RenderStats m_stats;
+    RenderStats m_frame_stats;
+    FramePacer pacer;
+    SceneTarget scene_target;
+    DynamicResolution m_dynamic_resolution;
+    float maze_scale;
+    unsigned int maze_samples;
+    bool maze_smooth;
+    bool maze_pass_offscreen;
+
     std::function<void (const sf::Keyboard::Key)> on_key_waiting;
     std::function<void ()> on_set_states;
 
+    // Scene pass on its own thread, which owns the context while it draws
+    std::thread scene_thread;
+    std::mutex scene_mutex;
+    std::condition_variable scene_cv;
+    bool scene_pending;
+    bool scene_stopping;
+    bool scene_drawn;
+    bool context_owned;
+
     void open_window(unsigned int width, unsigned int height, bool fullscreen);
     void open_window(sf::VideoMode video_mode, bool fullscreen);
     void update();
     void set_states();
-    unsigned int calc_max_antialiasing();
+    void sync(gui::MainMenu& main_menu);
+    void render_scene(IRenderable& renderable);
+    void render_gui(sfg::SFGUI& sfgui, gui::MainMenu& main_menu);
+    void render_gui_layer(sfg::SFGUI& sfgui, gui::MainMenu& main_menu);
+    void dispatch_scene();
+    void start_scene_thread(gui::MainMenu& main_menu);
+    void stop_scene_thread();
 #ifdef _WIN32
     void update_old_maximized();
 #endif
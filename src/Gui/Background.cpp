@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -49,6 +49,11 @@ Background::render() {
     glPopMatrix();
 }
 
+void
+Background::sync() {
+    m_renderable->sync();
+}
+
 ITickable<void*>*
 Background::tickable() const {
     return m_tickable;
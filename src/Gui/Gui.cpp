@@ -25,8 +25,10 @@ namespace mazemaze {
 namespace gui {
 
 Gui::Gui() : m_background(nullptr),
+             shown_background(nullptr),
              m_state(-1),
-             m_wants_exit(false) {}
+             m_wants_exit(false),
+             m_dirty(true) {}
 
 Gui::~Gui() {
     remove_states();
@@ -37,8 +39,14 @@ Gui::handle_event(const sf::Event& event) {
     if (event.is<sf::Event::Resized>()) {
         for (auto state : states)
             state->center();
+
+        invalidate();
     }
 
+    // Overlays don't take input, so only a shown state can react to it
+    if (m_state >= 0)
+        invalidate();
+
     on_event(event);
 
     m_desktop.HandleEvent(event);
@@ -51,15 +59,28 @@ Gui::on_event(const sf::Event&) {
 
 void
 Gui::tick(void* _, float delta_time) {
-    m_desktop.Update(delta_time);
+    if (visible())
+        m_desktop.Update(delta_time);
 
     tickable_handler.tick(_, delta_time);
+
+    for (auto state : states)
+        if (state->take_changed())
+            invalidate();
 }
 
 void
 Gui::render() {
-    if (m_background != nullptr)
-        m_background->render();
+    if (shown_background != nullptr)
+        shown_background->render();
+}
+
+void
+Gui::sync() {
+    shown_background = m_background;
+
+    if (shown_background != nullptr)
+        shown_background->sync();
 }
 
 void
@@ -115,6 +136,8 @@ Gui::reset_text() {
 
     for (auto state : states)
         state->reset_text();
+
+    invalidate();
 }
 
 void
@@ -125,6 +148,8 @@ Gui::add_overlay(int state_id) {
 
     tickable_handler.addTickable(states[state_id]);
     overlays.emplace_back(state_id);
+
+    invalidate();
 }
 
 void
@@ -140,6 +165,8 @@ Gui::remove_overlay(int state_id) {
             break;
         }
     }
+
+    invalidate();
 }
 
 void
@@ -165,6 +192,8 @@ Gui::set_state(int state, bool back) {
     }
 
     m_state = state;
+
+    invalidate();
 }
 
 void
@@ -185,6 +214,16 @@ Gui::exit() {
     on_exit();
 }
 
+void
+Gui::invalidate() {
+    m_dirty = true;
+}
+
+void
+Gui::validate() {
+    m_dirty = false;
+}
+
 sfg::Desktop&
 Gui::desktop() {
     return m_desktop;
@@ -205,5 +244,15 @@ Gui::wants_exit() const {
     return m_wants_exit;
 }
 
+bool
+Gui::visible() const {
+    return m_state >= 0 || !overlays.empty();
+}
+
+bool
+Gui::dirty() const {
+    return m_dirty;
+}
+
 }
 }
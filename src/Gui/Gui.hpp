@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -43,6 +43,7 @@ public:
 
     void tick(void*, float delta_time) override;
     void render() override;
+    void sync() override;
 
     void back();
     void back_to(int dest_state);
@@ -61,6 +62,11 @@ public:
 
     void exit();
 
+    // Asks for the GUI layer to be drawn again instead of reusing the
+    // cached one
+    void invalidate();
+    void validate();
+
     virtual void on_exit() = 0;
 
     sfg::Desktop& desktop();
@@ -68,11 +74,14 @@ public:
     State&        state(int state);
     Background&   background() const;
     bool          wants_exit() const;
+    bool          visible() const;
+    bool          dirty() const;
 
 private:
     sfg::Desktop m_desktop;
 
     Background* m_background;
+    Background* shown_background;
 
     std::vector<State*> states;
     std::stack <int>    state_stack;
@@ -82,6 +91,7 @@ private:
 
     int  m_state;
     bool m_wants_exit;
+    bool m_dirty;
 };
 
 }
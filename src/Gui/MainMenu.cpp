@@ -33,6 +33,7 @@
 #include "States/Main.hpp"
 #include "States/FpsOverlay.hpp"
 #include "States/Debug.hpp"
+#include "States/Profiler.hpp"
 
 namespace mazemaze {
 namespace gui {
@@ -41,7 +42,8 @@ MainMenu::MainMenu(Settings& settings) : game(nullptr),
                                          saver(new Saver(settings)),
                                          settings(settings),
                                          fps_show(false),
-                                         debug_show(false) {
+                                         debug_show(false),
+                                         profiler_show(false) {
     Logger::inst().log_debug("Starting main menu.");
 
     auto theme_file = "data" PATH_SEPARATOR "style.theme";
@@ -53,6 +55,7 @@ MainMenu::MainMenu(Settings& settings) : game(nullptr),
     m_main_state   = add_state(new states::Main      (*this, settings));
     m_fps_state    = add_state(new states::FpsOverlay(*this, settings));
     m_debug_state  = add_state(new states::Debug     (*this          ));
+    m_profiler_state = add_state(new states::Profiler(*this));
 
     set_state(m_main_state);
 
@@ -91,6 +94,10 @@ MainMenu::on_event(const sf::Event& event) {
 
         show_debug(!debug_show);
     }
+
+    if     (event.is<sf::Event::KeyReleased>() && event.getIf<sf::Event::KeyReleased>()->code ==
+            sf::Keyboard::Key::F4)
+        show_profiler(!profiler_show);
 }
 
 void
@@ -167,6 +174,18 @@ MainMenu::show_debug(bool show) {
     }
 }
 
+void
+MainMenu::show_profiler(bool show) {
+    if (profiler_show != show) {
+        if (show)
+            add_overlay(m_profiler_state);
+        else
+            remove_overlay(m_profiler_state);
+
+        profiler_show = show;
+    }
+}
+
 int
 MainMenu::options_state() const {
     return m_options_state;
@@ -187,9 +206,17 @@ MainMenu::show_debug() const {
     return debug_show;
 }
 
+void
+MainMenu::set_record_path(const std::string& path) {
+    record_path = path;
+}
+
 void
 MainMenu::setup_game() {
     set_background(game);
+
+    if (!record_path.empty())
+        game->record(record_path);
 }
 
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "Gui.hpp"
 #include "../Point2.hpp"
 
@@ -51,8 +53,10 @@ public:
     void stop_game();
     void show_fps(bool show);
     void show_debug(bool show);
+    void show_profiler(bool show);
 
     void set_options_state(states::OptionsMenu& options, int state);
+    void set_record_path(const std::string& path);
 
     int  options_state() const;
     bool show_fps() const;
@@ -68,10 +72,14 @@ private:
     int m_main_state;
     int m_fps_state;
     int m_debug_state;
+    int m_profiler_state;
     int m_options_state;
 
     bool fps_show;
     bool debug_show;
+    bool profiler_show;
+
+    std::string record_path;
 
     void setup_game();
 };
@@ -25,7 +25,8 @@ namespace gui {
 State::State(sfg::Desktop& desktop, const std::string& name) :
         name(name),
         desktop(desktop),
-        box(sfg::Box::Create()) {}
+        box(sfg::Box::Create()),
+        m_changed(false) {}
 
 State::~State() {
     desktop.Remove(main_container());
@@ -39,8 +40,8 @@ State::center() {
 void
 State::center(sfg::Widget::Ptr widget) {
     sf::Vector2f widget_Size(widget->GetAllocation().size);
-    sf::Vector2f window_Size =
-            static_cast<sf::Vector2f>(GraphicEngine::inst().window().getSize());
+    Point2i size = GraphicEngine::inst().window_size();
+    sf::Vector2f window_Size(size.x, size.y);
 
     widget->SetPosition((window_Size - widget_Size) / 2.0f);
 }
@@ -60,5 +61,18 @@ State::main_container() {
     return box;
 }
 
+bool
+State::take_changed() {
+    bool changed = m_changed;
+    m_changed = false;
+
+    return changed;
+}
+
+void
+State::changed() {
+    m_changed = true;
+}
+
 }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -41,11 +41,19 @@ public:
     virtual void reset_text() = 0;
     virtual sfg::Container::Ptr main_container();
 
+    // Whether the widgets changed since the last call, outside of events
+    bool take_changed();
+
 protected:
     sfg::Desktop& desktop;
     sfg::Box::Ptr box;
 
     virtual void center(sfg::Widget::Ptr widget);
+
+    void changed();
+
+private:
+    bool m_changed;
 };
 
 }
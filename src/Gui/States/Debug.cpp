@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2021-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -23,6 +23,7 @@
 
 #include "../MainMenu.hpp"
 
+#include "../../GraphicEngine.hpp"
 #include "../../Settings.hpp"
 #include "../../utils.hpp"
 
@@ -35,6 +36,7 @@ namespace states {
 Debug::Debug(MainMenu& main_menu) :
         State(main_menu.desktop(), "Debug"),
         log_box(Box::Create(Box::Orientation::VERTICAL)),
+        stats_label(Label::Create()),
         window(Window::Create(
             Window::Style::BACKGROUND |
             Window::Style::TITLEBAR |
@@ -54,8 +56,13 @@ Debug::Debug(MainMenu& main_menu) :
 
     char scrollbar_policy = ScrolledWindow::HORIZONTAL_NEVER | ScrolledWindow::VERTICAL_ALWAYS;
 
+    auto window_box = Box::Create(Box::Orientation::VERTICAL);
+
+    window_box->Pack(stats_label, false);
+    window_box->Pack(scrolled_window);
+
     window->SetClass("log_window");
-    window->Add(scrolled_window);
+    window->Add(window_box);
     window->SetTitle(pgtx("debug", "Debug log"));
     window->SetPosition({ 16.0f, 16.0f });
 
@@ -70,6 +77,9 @@ Debug::Debug(MainMenu& main_menu) :
     log_box->SetRequisition({ 640.0f, 0.0f });
     log_box->SetClass("log_box");
 
+    stats_label->SetClass("debug");
+    stats_label->SetAlignment({ 0.0f, 0.5f });
+
     tick(nullptr, 0.0f);
 
     desktop.Add(window);
@@ -87,6 +97,9 @@ Debug::tick(void*, float) {
     if (!showing)
         return;
 
+    update_stats();
+    changed();
+
     bool first = true;
     bool adjustement_pinned = false;
 
@@ -127,6 +140,21 @@ void
 Debug::reset_text() {
 }
 
+void
+Debug::update_stats() {
+    const RenderStats& stats = GraphicEngine::inst().frame_stats();
+
+    stats_label->SetText(fmt("Resident chunks: %d, %.1f / %.1f KiB, %d compiled, %d prefetched, "
+                             "%d GL state calls saved, %d%% resolution",
+                             stats.resident_chunks,
+                             stats.resident_bytes / 1024.0f,
+                             stats.chunks_budget  / 1024.0f,
+                             stats.compiled_chunks,
+                             stats.prefetched_chunks,
+                             stats.saved_state_calls,
+                             static_cast<int>(stats.resolution_scale * 100.0f + 0.5f)));
+}
+
 Widget::Ptr
 Debug::create_log_element(Logger::Message& message, bool odd) {
     auto element = Window::Create(Window::Style::NO_STYLE);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2021-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -43,6 +43,7 @@ public:
 
 private:
     sfg::Box::Ptr log_box;
+    sfg::Label::Ptr stats_label;
     sfg::Window::Ptr window;
     sfg::ScrolledWindow::Ptr scrolled_window;
     std::queue<Logger::Message> not_displayed_messages;
@@ -50,6 +51,7 @@ private:
     bool showing;
     bool odd;
 
+    void update_stats();
     sfg::Widget::Ptr create_log_element(Logger::Message& message, bool odd);
     float adjustement_upper_value();
     float adjustement_value();
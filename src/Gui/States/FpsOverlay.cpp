@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -21,6 +21,7 @@
 
 #include "../MainMenu.hpp"
 
+#include "../../GraphicEngine.hpp"
 #include "../../Settings.hpp"
 #include "../../utils.hpp"
 
@@ -34,16 +35,38 @@ FpsOverlay::FpsOverlay(MainMenu& main_menu, Settings& settings) :
         State(main_menu.desktop(), "FpsOverlay"),
         settings(settings),
         fps_calculator([this] (float fps) {
+            const RenderStats& stats = GraphicEngine::inst().frame_stats();
+
             fpsLabel->SetText(fmt("%.2f", fps));
+            chunks_label->SetText(fmt("%d/%d", stats.drawn_chunks,
+                                               stats.drawn_chunks +
+                                               stats.culled_chunks +
+                                               stats.occluded_chunks));
+            scale_label->SetText(fmt("%d%%", static_cast<int>(stats.resolution_scale * 100.0f +
+                                                              0.5f)));
             box->UpdateDrawablePosition();
+
+            changed();
         }, 0.5f),
         showing(false) {
     auto window = Window::Create(Window::Style::BACKGROUND);
 
+    auto window_box = Box::Create(Box::Orientation::VERTICAL);
+
     fpsLabel = Label::Create(L"00,00");
     fpsLabel->SetClass("fps");
 
-    window->Add(fpsLabel);
+    chunks_label = Label::Create(L"0/0");
+    chunks_label->SetClass("fps");
+
+    scale_label = Label::Create(L"100%");
+    scale_label->SetClass("fps");
+
+    window_box->Pack(fpsLabel);
+    window_box->Pack(chunks_label);
+    window_box->Pack(scale_label);
+
+    window->Add(window_box);
 
     box->Pack(window);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -42,6 +42,8 @@ public:
 
 private:
     sfg::Label::Ptr fpsLabel;
+    sfg::Label::Ptr chunks_label;
+    sfg::Label::Ptr scale_label;
     Settings& settings;
     FpsCalculator fps_calculator;
 
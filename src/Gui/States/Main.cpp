@@ -101,8 +101,8 @@ void
 Main::center() {
     sf::Vector2f widget_size(about_button->GetAllocation().size);
 
-    sf::Vector2f window_size =
-        static_cast<sf::Vector2f>(GraphicEngine::inst().window().getSize());
+    Point2i size = GraphicEngine::inst().window_size();
+    sf::Vector2f window_size(size.x, size.y);
 
     about_button->Show(showing && window_size.x > 640 && window_size.y > 300);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -130,6 +130,9 @@ NewGame::NewGame(MainMenu& main_menu) :
 void
 NewGame::tick(void*, float) {
     old_cursor = size_entry->GetCursorPosition();
+
+    // The cursor of the entry blinks
+    changed();
 }
 
 void
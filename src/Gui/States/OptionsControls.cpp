@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -39,6 +39,7 @@ OptionsControls::OptionsControls(MainMenu& main_menu, Settings& settings) :
             Option(Button::Create()),
             Option(Button::Create()),
             Option(Button::Create()),
+            Option(Button::Create()),
             Option(Button::Create())
         },
         key_controls {
@@ -46,6 +47,7 @@ OptionsControls::OptionsControls(MainMenu& main_menu, Settings& settings) :
             "down",
             "right",
             "left",
+            "minimap",
         } {
     reset_text();
 
@@ -112,7 +114,8 @@ OptionsControls::on_reset_text() {
         pgtx("options", "Forward"),
         pgtx("options", "Backward"),
         pgtx("options", "Right"),
-        pgtx("options", "Left")
+        pgtx("options", "Left"),
+        pgtx("options", "Minimap")
     };
 
     for (int i = 0; i < buttons_count; i++)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -42,7 +42,7 @@ namespace states {
 
 class OptionsControls : public Options {
 public:
-    static const int buttons_count = 4;
+    static const int buttons_count = 5;
 
     explicit OptionsControls(MainMenu& main_menu, Settings& settings);
     ~OptionsControls() override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -22,6 +22,7 @@
 #include "../../utils.hpp"
 #include "../../Settings.hpp"
 
+#include <algorithm>
 #include <memory>
 
 using namespace sfg;
@@ -49,10 +50,30 @@ OptionsGraphics::init_signals() {
         settings.set_antialiasing(antialiasing);
     });
 
+    smooth_edges_check->GetSignal(Widget::OnLeftClick).Connect([this] () {
+        settings.set_smooth_edges(smooth_edges_check->IsActive());
+    });
+
     vsync_check->GetSignal(Widget::OnLeftClick).Connect([this] () {
         settings.set_vsync(vsync_check->IsActive());
     });
 
+    fps_limit_combo->GetSignal(ComboBox::OnSelect).Connect([this] () {
+        settings.set_fps_limit(fps_limits[fps_limit_combo->GetSelectedItem()]);
+    });
+
+    menu_fps_limit_combo->GetSignal(ComboBox::OnSelect).Connect([this] () {
+        settings.set_menu_fps_limit(menu_fps_limits[menu_fps_limit_combo->GetSelectedItem()]);
+    });
+
+    render_thread_check->GetSignal(Widget::OnLeftClick).Connect([this] () {
+        settings.set_render_thread(render_thread_check->IsActive());
+    });
+
+    dynamic_resolution_check->GetSignal(Widget::OnLeftClick).Connect([this] () {
+        settings.set_dynamic_resolution(dynamic_resolution_check->IsActive());
+    });
+
     style_combo->GetSignal(ComboBox::OnSelect).Connect([this] () {
         settings.set_renderer(style_combo->GetSelectedItem());
     });
@@ -60,6 +81,14 @@ OptionsGraphics::init_signals() {
     camera_bobbing_check->GetSignal(Widget::OnLeftClick).Connect([this] () {
         settings.set_camera_bobbing(camera_bobbing_check->IsActive());
     });
+
+    shaders_check->GetSignal(Widget::OnLeftClick).Connect([this] () {
+        settings.set_shaders(shaders_check->IsActive());
+    });
+
+    baked_lighting_check->GetSignal(Widget::OnLeftClick).Connect([this] () {
+        settings.set_baked_lighting(baked_lighting_check->IsActive());
+    });
 }
 
 void
@@ -72,6 +101,27 @@ OptionsGraphics::init_antialiasing_combo() {
         antialiasing_combo->AppendItem(fmt("%dx", i));
 }
 
+void
+OptionsGraphics::init_fps_limit_combo(ComboBox::Ptr combo,
+                                      std::vector<unsigned int>& limits,
+                                      unsigned int limit) {
+    // Keep a limit set by hand in the config selectable
+    if (std::find(limits.begin(), limits.end(), limit) == limits.end()) {
+        limits.push_back(limit);
+        std::sort(limits.begin(), limits.end());
+    }
+
+    for (unsigned int i = 0; i < limits.size(); i++) {
+        if (limits[i] == 0)
+            combo->AppendItem("");
+        else
+            combo->AppendItem(fmt("%d", limits[i]));
+
+        if (limits[i] == limit)
+            combo->SelectItem(i);
+    }
+}
+
 void
 OptionsGraphics::init_options() {
     fullscreen_check->SetActive(settings.fullscreen());
@@ -89,8 +139,16 @@ OptionsGraphics::init_options() {
             break;
         }
 
+    smooth_edges_check->SetActive(settings.smooth_edges());
     vsync_check->SetActive(settings.vsync());
 
+    init_fps_limit_combo(fps_limit_combo, fps_limits, settings.fps_limit());
+    init_fps_limit_combo(menu_fps_limit_combo, menu_fps_limits, settings.menu_fps_limit());
+
+    render_thread_check->SetActive(settings.render_thread());
+    dynamic_resolution_check->SetActive(settings.dynamic_resolution());
+
+    style_combo->AppendItem("");
     style_combo->AppendItem("");
     style_combo->AppendItem("");
     style_combo->AppendItem("");
@@ -98,25 +156,51 @@ OptionsGraphics::init_options() {
     style_combo->SelectItem(settings.renderer());
 
     camera_bobbing_check->SetActive(settings.camera_bobbing());
+
+    shaders_check->SetActive(settings.shaders());
+    baked_lighting_check->SetActive(settings.baked_lighting());
 }
 
 OptionsGraphics::OptionsGraphics(MainMenu& main_menu, Settings& settings) :
         Options(main_menu, settings, "OptionsGraphics"),
         fullscreen_check    (CheckButton::Create(L"")),
         vsync_check         (CheckButton::Create(L"")),
+        fps_limit_combo     (ComboBox::Create()),
+        menu_fps_limit_combo(ComboBox::Create()),
+        render_thread_check (CheckButton::Create(L"")),
+        dynamic_resolution_check(CheckButton::Create(L"")),
         antialiasing_combo  (ComboBox::Create()),
+        smooth_edges_check  (CheckButton::Create(L"")),
         style_combo         (ComboBox::Create()),
         camera_bobbing_check(CheckButton::Create(L"")),
+        shaders_check       (CheckButton::Create(L"")),
+        baked_lighting_check(CheckButton::Create(L"")),
         fullscreen_opt    (Option("", fullscreen_check)),
         vsync_opt         (Option("", vsync_check)),
+        fps_limit_opt     (Option("", fps_limit_combo)),
+        menu_fps_limit_opt(Option("", menu_fps_limit_combo)),
+        render_thread_opt (Option("", render_thread_check)),
+        dynamic_resolution_opt(Option("", dynamic_resolution_check)),
         antialiasing_opt  (Option("", antialiasing_combo)),
+        smooth_edges_opt  (Option("", smooth_edges_check)),
         style_opt         (Option("", style_combo)),
-        camera_bobbing_opt(Option("", camera_bobbing_check)) {
+        camera_bobbing_opt(Option("", camera_bobbing_check)),
+        shaders_opt       (Option("", shaders_check)),
+        baked_lighting_opt(Option("", baked_lighting_check)),
+        fps_limits{0, 30, 60, 75, 120, 144, 240},
+        menu_fps_limits{0, 15, 30, 60} {
     window_box->Pack(fullscreen_opt.to_widget());
     window_box->Pack(antialiasing_opt.to_widget());
+    window_box->Pack(smooth_edges_opt.to_widget());
     window_box->Pack(vsync_opt.to_widget());
+    window_box->Pack(fps_limit_opt.to_widget());
+    window_box->Pack(menu_fps_limit_opt.to_widget());
+    window_box->Pack(render_thread_opt.to_widget());
+    window_box->Pack(dynamic_resolution_opt.to_widget());
     window_box->Pack(style_opt.to_widget());
     window_box->Pack(camera_bobbing_opt.to_widget());
+    window_box->Pack(shaders_opt.to_widget());
+    window_box->Pack(baked_lighting_opt.to_widget());
 
     init_signals();
     init_options();
@@ -130,20 +214,35 @@ void
 OptionsGraphics::on_reset_text() {
     fullscreen_opt   .change_text(pgtx("options", "Fullscreen"));
     vsync_opt        .change_text(pgtx("options", "V-Sync"));
+    fps_limit_opt    .change_text(pgtx("options", "FPS Limit"));
+    menu_fps_limit_opt.change_text(pgtx("options", "Menu FPS Limit"));
+    render_thread_opt .change_text(pgtx("options", "Render Thread"));
+    dynamic_resolution_opt.change_text(pgtx("options", "Dynamic Resolution"));
     antialiasing_opt .change_text(pgtx("options", "Antialiasing"));
+    smooth_edges_opt .change_text(pgtx("options", "Smooth Edges"));
     style_opt        .change_text(pgtx("options", "Style"));
     camera_bobbing_opt.change_text(pgtx("options", "Camera Bobbing"));
+    shaders_opt      .change_text(pgtx("options", "Shaders"));
+    baked_lighting_opt.change_text(pgtx("options", "Baked Lighting"));
 
     style_combo->ChangeItem(0, pgtx("options", "Classic"));
     style_combo->ChangeItem(1, pgtx("options", "Gray"));
     style_combo->ChangeItem(2, pgtx("options", "Brick"));
     style_combo->ChangeItem(3, pgtx("options", "Night Brick"));
+    style_combo->ChangeItem(4, pgtx("options", "Raycast"));
 
     style_combo->RequestResize();
 
     antialiasing_combo->ChangeItem(0, pgtx("options", "No"));
 
     antialiasing_combo->RequestResize();
+
+    // The "No" item is always first since the limits are sorted
+    fps_limit_combo->ChangeItem(0, pgtx("options", "No"));
+    menu_fps_limit_combo->ChangeItem(0, pgtx("options", "No"));
+
+    fps_limit_combo->RequestResize();
+    menu_fps_limit_combo->RequestResize();
 }
 
 OptionsGraphics::~OptionsGraphics() = default;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -21,6 +21,8 @@
 
 #include "Options.hpp"
 
+#include <vector>
+
 #include <SFGUI/SFGUI.hpp>
 
 namespace mazemaze {
@@ -43,18 +45,38 @@ public:
 private:
     sfg::CheckButton::Ptr fullscreen_check;
     sfg::CheckButton::Ptr vsync_check;
+    sfg::ComboBox::Ptr    fps_limit_combo;
+    sfg::ComboBox::Ptr    menu_fps_limit_combo;
+    sfg::CheckButton::Ptr render_thread_check;
+    sfg::CheckButton::Ptr dynamic_resolution_check;
     sfg::ComboBox::Ptr    antialiasing_combo;
+    sfg::CheckButton::Ptr smooth_edges_check;
     sfg::ComboBox::Ptr    style_combo;
     sfg::CheckButton::Ptr camera_bobbing_check;
+    sfg::CheckButton::Ptr shaders_check;
+    sfg::CheckButton::Ptr baked_lighting_check;
 
     Option fullscreen_opt;
     Option vsync_opt;
+    Option fps_limit_opt;
+    Option menu_fps_limit_opt;
+    Option render_thread_opt;
+    Option dynamic_resolution_opt;
     Option antialiasing_opt;
+    Option smooth_edges_opt;
     Option style_opt;
     Option camera_bobbing_opt;
+    Option shaders_opt;
+    Option baked_lighting_opt;
+
+    std::vector<unsigned int> fps_limits;
+    std::vector<unsigned int> menu_fps_limits;
 
     void init_signals();
     void init_antialiasing_combo();
+    void init_fps_limit_combo(sfg::ComboBox::Ptr combo,
+                              std::vector<unsigned int>& limits,
+                              unsigned int limit);
     void init_options();
 };
 
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Profiler.hpp"
+
+#include <string>
+
+#include <SFGUI/Widgets.hpp>
+
+#include "../MainMenu.hpp"
+
+#include "../../FrameProfiler.hpp"
+#include "../../GraphicEngine.hpp"
+#include "../../utils.hpp"
+
+using namespace sfg;
+
+namespace mazemaze {
+namespace gui {
+namespace states {
+
+Profiler::Profiler(MainMenu& main_menu) :
+        State(main_menu.desktop(), "Profiler"),
+        showing(false),
+        time_passed(0.0f) {
+    auto window = Window::Create(Window::Style::BACKGROUND);
+
+    phases_label = Label::Create();
+    phases_label->SetClass("profiler");
+    phases_label->SetAlignment(sf::Vector2f(0.0f, 0.0f));
+
+    window->Add(phases_label);
+
+    box->Pack(window);
+
+    desktop.Add(box);
+}
+
+Profiler::~Profiler() = default;
+
+void
+Profiler::show(bool show) {
+    box->Show(show);
+
+    showing = show;
+
+    if (show)
+        update_text();
+}
+
+void
+Profiler::reset_text() {}
+
+void
+Profiler::tick(void*, float delta_time) {
+    if (!showing)
+        return;
+
+    time_passed += delta_time;
+
+    if (time_passed >= 0.5f) {
+        time_passed = 0.0f;
+        update_text();
+        changed();
+    }
+}
+
+void
+Profiler::center() {
+    Point2i window_size = GraphicEngine::inst().window_size();
+
+    box->SetPosition(sf::Vector2f(window_size.x - box->GetAllocation().size.x, 0.0f));
+}
+
+void
+Profiler::update_text() {
+    FrameProfiler& profiler = FrameProfiler::inst();
+
+    std::string text = profiler.gpu_timing() ? "phase       cpu avg/max   gpu avg/max"
+                                             : "phase       cpu avg/max";
+
+    for (int i = 0; i < FrameProfiler::PHASES_COUNT; i++) {
+        auto phase = static_cast<FrameProfiler::Phase>(i);
+        auto timing = profiler.timing(phase);
+
+        text += fmt("\n%-10s %5.2f/%5.2f", FrameProfiler::name(phase),
+                                          timing.cpu_avg, timing.cpu_max);
+
+        if (profiler.gpu_timing())
+            text += fmt("   %5.2f/%5.2f", timing.gpu_avg, timing.gpu_max);
+    }
+
+    phases_label->SetText(text);
+
+    center();
+}
+
+}
+}
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -22,6 +22,11 @@ namespace mazemaze {
 class IRenderable {
 public:
     virtual void render() = 0;
+
+    // Called between frames, while nothing is drawn, to hand over what
+    // render() needs from the ticking side
+    virtual void sync();
+
     virtual ~IRenderable();
 };
 
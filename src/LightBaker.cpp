@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LightBaker.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <SFML/OpenGL.hpp>
+
+#include "LightingShader.hpp"
+#include "Maze.hpp"
+
+namespace mazemaze {
+
+LightBaker::LightBaker(const Lighting& lighting, const Maze& maze, Point2i offset, bool baked) :
+        lighting(lighting),
+        maze(maze),
+        offset(offset),
+        baked(baked) {
+    const Pointf& direction = lighting.sun_direction;
+    float length = std::sqrt(direction.x * direction.x +
+                             direction.y * direction.y +
+                             direction.z * direction.z);
+
+    sun = Pointf(direction.x / length, direction.y / length, direction.z / length);
+}
+
+LightBaker::~LightBaker() = default;
+
+void
+LightBaker::albedo(float r, float g, float b) {
+    m_albedo = Pointf(r, g, b);
+
+    if (!baked)
+        glColor3f(r, g, b);
+}
+
+void
+LightBaker::normal(float x, float y, float z) {
+    m_normal = Pointf(x, y, z);
+
+    glNormal3f(x, y, z);
+}
+
+void
+LightBaker::vertex(int x, int y, int z) {
+    if (baked) {
+        // Tops of the walls are never occluded
+        bool top = m_normal.y > 0.0f && y > 0;
+
+        color(m_albedo, m_normal,
+              top ? 1.0f : occlusion(Point2i(offset.x + x, offset.y + z), y));
+    }
+
+    glVertex3i(x, y, z);
+}
+
+Pointf
+LightBaker::lit(Pointf albedo, Pointf normal, float occlusion) const {
+    float diffuse = std::max(normal.x * sun.x + normal.y * sun.y + normal.z * sun.z, 0.0f);
+
+    // Same terms as the fixed pipeline, 0.2 is its global ambient
+    auto channel = [diffuse, occlusion] (float albedo, float ambient, float sun_diffuse) {
+        return albedo * std::min(0.2f + ambient + sun_diffuse * diffuse, 1.0f) * occlusion;
+    };
+
+    return Pointf(channel(albedo.x, lighting.sun_ambient.x, lighting.sun_diffuse.x),
+                  channel(albedo.y, lighting.sun_ambient.y, lighting.sun_diffuse.y),
+                  channel(albedo.z, lighting.sun_ambient.z, lighting.sun_diffuse.z));
+}
+
+void
+LightBaker::color(Pointf albedo, Pointf normal, float occlusion) const {
+    Pointf color = lit(albedo, normal, occlusion);
+
+    glColor3f(color.x, color.y, color.z);
+}
+
+float
+LightBaker::occlusion(Point2i corner, int height) const {
+    int walls = 0;
+
+    for (int x = corner.x - 1; x <= corner.x; x++)
+        for (int y = corner.y - 1; y <= corner.y; y++)
+            if (!maze.get_opened(Point2i(x, y)))
+                walls++;
+
+    // Only inner corners are occluded at the top of the walls
+    if (height > 0)
+        return walls >= 3 ? 0.85f : 1.0f;
+
+    const float floor[] = { 1.0f, 0.9f, 0.8f, 0.65f, 0.65f };
+
+    return floor[walls];
+}
+
+}
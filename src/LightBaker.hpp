@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Point.hpp"
+#include "Point2.hpp"
+
+namespace mazemaze {
+
+class Maze;
+struct Lighting;
+
+// Bakes a style's sun and ambient light, plus ambient occlusion from the
+// neighbouring cells, into vertex colours while a chunk is compiled.
+//
+// albedo(), normal() and vertex() stand in for glColor3f, glNormal3f and
+// glVertex3i, so the same compile code works baked or not.
+class LightBaker {
+public:
+    explicit LightBaker(const Lighting& lighting, const Maze& maze, Point2i offset, bool baked);
+    ~LightBaker();
+
+    void albedo(float r, float g, float b);
+    void normal(float x, float y, float z);
+    void vertex(int x, int y, int z);
+
+    // Albedo lit for the world space normal
+    Pointf lit(Pointf albedo, Pointf normal, float occlusion = 1.0f) const;
+
+    // Sets the current colour to lit()
+    void color(Pointf albedo, Pointf normal, float occlusion = 1.0f) const;
+
+    // Occlusion at a cell corner, from how many of the four cells sharing
+    // it are walls. Height 0 is the floor, 1 the top of the walls.
+    float occlusion(Point2i corner, int height) const;
+
+private:
+    const Lighting& lighting;
+    const Maze& maze;
+    Point2i offset;
+    bool baked;
+
+    Pointf sun;
+    Pointf m_albedo;
+    Pointf m_normal;
+};
+
+}
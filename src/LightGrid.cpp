@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LightGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Chunk.hpp"
+#include "Maze.hpp"
+
+namespace mazemaze {
+
+LightGrid::LightGrid(Maze& maze, float radius, unsigned int spacing) :
+        maze(maze),
+        m_radius(radius),
+        spacing(spacing),
+        seed(0) {}
+
+LightGrid::~LightGrid() = default;
+
+int
+LightGrid::nearest(int num, Pointf position, Pointf out[], int max) {
+    const std::vector<Pointf>& lights = chunk_lights(num);
+
+    auto distance = [&position] (const Pointf& light) {
+        return (light.x - position.x) * (light.x - position.x) +
+               (light.z - position.z) * (light.z - position.z);
+    };
+
+    int count = std::min(static_cast<int>(lights.size()), max);
+
+    std::partial_sort_copy(lights.begin(), lights.end(), out, out + count,
+                           [&distance] (const Pointf& a, const Pointf& b) {
+        return distance(a) < distance(b);
+    });
+
+    return count;
+}
+
+const std::vector<Pointf>&
+LightGrid::chunk_lights(int num) {
+    // Chunks are rebuilt whenever a new maze is generated or loaded
+    if (seed != maze.seed() || chunks.empty()) {
+        clear();
+
+        seed = maze.seed();
+
+        Point2i count = maze.chunks_count();
+
+        chunks.resize(count.x * count.y);
+        built.resize(count.x * count.y, false);
+    }
+
+    if (!built[num]) {
+        build(num);
+        built[num] = true;
+    }
+
+    return chunks[num];
+}
+
+float
+LightGrid::radius() const {
+    return m_radius;
+}
+
+void
+LightGrid::clear() {
+    chunks.clear();
+    built.clear();
+}
+
+void
+LightGrid::build(int num) {
+    const int size   = static_cast<int>(Chunk::SIZE);
+    const int margin = static_cast<int>(std::ceil(m_radius));
+
+    Point2i start((num % maze.chunks_count().x) * size,
+                  (num / maze.chunks_count().x) * size);
+
+    std::vector<Pointf>& lights = chunks[num];
+
+    for (int x = start.x - margin; x < start.x + size + margin; x++)
+        for (int y = start.y - margin; y < start.y + size + margin; y++) {
+            Pointf position;
+
+            if (!torch(Point2i(x, y), position))
+                continue;
+
+            // Distance from the light to the chunk's rectangle
+            float dx = std::max({start.x - position.x, 0.0f, position.x - (start.x + size)});
+            float dz = std::max({start.y - position.z, 0.0f, position.z - (start.y + size)});
+
+            if (dx * dx + dz * dz <= m_radius * m_radius)
+                lights.push_back(position);
+        }
+}
+
+bool
+LightGrid::torch(Point2i cell, Pointf& position) const {
+    if (cell.x < 0 || cell.y < 0 || cell.x >= maze.size().x || cell.y >= maze.size().y)
+        return false;
+
+    if (!maze.get_opened(cell))
+        return false;
+
+    unsigned int hash = seed;
+
+    hash ^= static_cast<unsigned int>(cell.x) * 0x9E3779B1u;
+    hash ^= static_cast<unsigned int>(cell.y) * 0x85EBCA77u;
+    hash ^= hash >> 15;
+    hash *= 0xC2B2AE3Du;
+    hash ^= hash >> 13;
+
+    if (hash % spacing != 0)
+        return false;
+
+    const Point2i sides[] {
+        Point2i( 1,  0),
+        Point2i( 0,  1),
+        Point2i(-1,  0),
+        Point2i( 0, -1)
+    };
+
+    // Hang the torch on one of the cell's walls, picked by the hash too
+    for (int i = 0; i < 4; i++) {
+        const Point2i& side = sides[(hash / spacing + i) % 4];
+
+        if (!maze.get_opened(Point2i(cell.x + side.x, cell.y + side.y))) {
+            position = Pointf(cell.x + 0.5f + side.x * 0.4f,
+                              0.7f,
+                              cell.y + 0.5f + side.y * 0.4f);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Point.hpp"
+#include "Point2.hpp"
+
+namespace mazemaze {
+
+class Maze;
+
+// Torches hung on maze walls, clustered by chunk. Placement only depends on
+// the maze and its seed, so every chunk's list is built on first use and
+// only holds the torches whose light reaches into that chunk.
+class LightGrid {
+public:
+    explicit LightGrid(Maze& maze, float radius, unsigned int spacing);
+    ~LightGrid();
+
+    // Up to max lights reaching chunk num, closest to position first
+    int nearest(int num, Pointf position, Pointf out[], int max);
+
+    const std::vector<Pointf>& chunk_lights(int num);
+    float radius() const;
+
+    void clear();
+
+private:
+    Maze& maze;
+    float m_radius;
+    unsigned int spacing;
+    unsigned int seed;
+
+    std::vector<std::vector<Pointf>> chunks;
+    std::vector<bool> built;
+
+    void build(int num);
+    bool torch(Point2i cell, Pointf& position) const;
+};
+
+}
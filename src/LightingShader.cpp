@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LightingShader.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Camera.hpp"
+#include "Logger.hpp"
+#include "path_separator.hpp"
+
+namespace mazemaze {
+
+LightingShader::LightingShader() :
+        m_enabled(true),
+        load_failed(false) {}
+
+LightingShader::~LightingShader() = default;
+
+bool
+LightingShader::bind(const Lighting& lighting, const Camera& camera) {
+    if (!active())
+        return false;
+
+    Pointf sun = camera.view_rotation().transform_direction(lighting.sun_direction);
+    float length = std::sqrt(sun.x * sun.x + sun.y * sun.y + sun.z * sun.z);
+
+    if (length > 0.0f)
+        sun = Pointf(sun.x / length, sun.y / length, sun.z / length);
+
+    auto vec3 = [] (Pointf point) {
+        return sf::Glsl::Vec3(point.x, point.y, point.z);
+    };
+
+    shader->setUniform("baked",         lighting.baked);
+    shader->setUniform("sun_direction", vec3(sun));
+    shader->setUniform("sun_diffuse",   vec3(lighting.sun_diffuse));
+    shader->setUniform("sun_ambient",   vec3(lighting.sun_ambient));
+
+    shader->setUniform("torch", lighting.torch);
+
+    if (lighting.torch) {
+        shader->setUniform("torch_diffuse", vec3(lighting.torch_diffuse));
+        shader->setUniform("torch_constant_attenuation", lighting.torch_constant_attenuation);
+        shader->setUniform("torch_linear_attenuation",   lighting.torch_linear_attenuation);
+    }
+
+    shader->setUniform("wall_torch_diffuse", vec3(lighting.wall_torch_diffuse));
+    shader->setUniform("wall_torch_quadratic_attenuation",
+                       lighting.wall_torch_quadratic_attenuation);
+    shader->setUniform("wall_torches_count", 0);
+
+    shader->setUniform("fog", lighting.fog);
+
+    if (lighting.fog) {
+        shader->setUniform("fog_color",   vec3(lighting.fog_color));
+        shader->setUniform("fog_density", lighting.fog_density);
+    }
+
+    sf::Shader::bind(shader.get());
+
+    return true;
+}
+
+void
+LightingShader::unbind() {
+    sf::Shader::bind(nullptr);
+}
+
+void
+LightingShader::set_wall_torches(const Pointf positions[], int count, const Camera& camera) {
+    sf::Glsl::Vec3 eye_positions[MAX_WALL_TORCHES];
+    Matrix4f view = camera.view();
+
+    count = std::min(count, static_cast<int>(MAX_WALL_TORCHES));
+
+    for (int i = 0; i < count; i++) {
+        Pointf eye = view.transform_point(positions[i]);
+        eye_positions[i] = sf::Glsl::Vec3(eye.x, eye.y, eye.z);
+    }
+
+    shader->setUniform("wall_torches_count", count);
+
+    if (count > 0)
+        shader->setUniformArray("wall_torch_positions", eye_positions, count);
+}
+
+void
+LightingShader::set_enabled(bool enabled) {
+    m_enabled = enabled;
+}
+
+bool
+LightingShader::enabled() const {
+    return m_enabled;
+}
+
+bool
+LightingShader::active() {
+    if (!m_enabled || load_failed)
+        return false;
+
+    return shader || load();
+}
+
+bool
+LightingShader::load() {
+    if (!sf::Shader::isAvailable()) {
+        Logger::inst().log_warn("Shaders are not supported, using fixed-function lighting.");
+        load_failed = true;
+
+        return false;
+    }
+
+    shader = std::make_unique<sf::Shader>();
+
+    if (!shader->loadFromFile("data" PATH_SEPARATOR "lighting.vert",
+                              "data" PATH_SEPARATOR "lighting.frag")) {
+        Logger::inst().log_error("Can not load lighting shader, using fixed-function lighting.");
+
+        shader.reset();
+        load_failed = true;
+
+        return false;
+    }
+
+    Logger::inst().log_debug("Lighting shader loaded.");
+
+    return true;
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <SFML/Graphics/Shader.hpp>
+
+#include "Point.hpp"
+
+namespace mazemaze {
+
+class Camera;
+
+// What a style's fixed-function lights and fog do, as shader uniforms
+struct Lighting {
+    // Sun and ambient light are already in the vertex colours
+    bool   baked = false;
+
+    Pointf sun_direction;
+    Pointf sun_diffuse;
+    Pointf sun_ambient;
+
+    bool   torch = false;
+    Pointf torch_diffuse;
+    float  torch_constant_attenuation = 1.0f;
+    float  torch_linear_attenuation   = 0.0f;
+
+    // Lights from a LightGrid, set per chunk with set_wall_torches
+    Pointf wall_torch_diffuse;
+    float  wall_torch_quadratic_attenuation = 0.0f;
+
+    bool   fog = false;
+    Pointf fog_color;
+    float  fog_density = 0.0f;
+};
+
+// GLSL replacement for the fixed-function lighting and fog. Falls back to
+// the fixed pipeline when shaders are disabled, unsupported or fail to
+// compile.
+class LightingShader {
+public:
+    static const int MAX_WALL_TORCHES = 6;
+
+    // Uploads the uniforms and binds the program, returns false when the
+    // fixed pipeline has to be used instead
+    bool bind(const Lighting& lighting, const Camera& camera);
+    void unbind();
+
+    // Only valid while bound, positions are in world space
+    void set_wall_torches(const Pointf positions[], int count, const Camera& camera);
+
+    void set_enabled(bool enabled);
+    bool enabled() const;
+    bool active();
+
+    LightingShader(LightingShader const&) = delete;
+    void operator= (LightingShader const&) = delete;
+
+    static LightingShader& inst() {
+        static LightingShader instance;
+        return instance;
+    }
+
+private:
+    std::unique_ptr<sf::Shader> shader;
+    // Set from the GUI, read while the render thread binds the shader
+    std::atomic<bool> m_enabled;
+    bool load_failed;
+
+    LightingShader();
+    ~LightingShader();
+
+    bool load();
+};
+
+}
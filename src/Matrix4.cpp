@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Matrix4.hpp"
+
+#include <cmath>
+
+namespace mazemaze {
+
+Matrix4f::Matrix4f() : m{} {
+    for (int i = 0; i < 4; i++)
+        at(i, i) = 1.0f;
+}
+
+Matrix4f::~Matrix4f() = default;
+
+Matrix4f
+Matrix4f::operator*(const Matrix4f& other) const {
+    Matrix4f result;
+
+    for (int row = 0; row < 4; row++)
+        for (int column = 0; column < 4; column++) {
+            float sum = 0.0f;
+
+            for (int i = 0; i < 4; i++)
+                sum += at(row, i) * other.at(i, column);
+
+            result.at(row, column) = sum;
+        }
+
+    return result;
+}
+
+Pointf
+Matrix4f::transform_point(Pointf point) const {
+    Pointf result = transform_direction(point);
+
+    result.x += at(0, 3);
+    result.y += at(1, 3);
+    result.z += at(2, 3);
+
+    return result;
+}
+
+Pointf
+Matrix4f::transform_direction(Pointf direction) const {
+    return Pointf(at(0, 0) * direction.x + at(0, 1) * direction.y + at(0, 2) * direction.z,
+                  at(1, 0) * direction.x + at(1, 1) * direction.y + at(1, 2) * direction.z,
+                  at(2, 0) * direction.x + at(2, 1) * direction.y + at(2, 2) * direction.z);
+}
+
+const float*
+Matrix4f::data() const {
+    return m;
+}
+
+Matrix4f
+Matrix4f::rotation_x(float angle) {
+    Matrix4f result;
+
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+
+    result.at(1, 1) =  c;
+    result.at(1, 2) = -s;
+    result.at(2, 1) =  s;
+    result.at(2, 2) =  c;
+
+    return result;
+}
+
+Matrix4f
+Matrix4f::rotation_y(float angle) {
+    Matrix4f result;
+
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+
+    result.at(0, 0) =  c;
+    result.at(0, 2) =  s;
+    result.at(2, 0) = -s;
+    result.at(2, 2) =  c;
+
+    return result;
+}
+
+Matrix4f
+Matrix4f::rotation_z(float angle) {
+    Matrix4f result;
+
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+
+    result.at(0, 0) =  c;
+    result.at(0, 1) = -s;
+    result.at(1, 0) =  s;
+    result.at(1, 1) =  c;
+
+    return result;
+}
+
+Matrix4f
+Matrix4f::translation(Pointf offset) {
+    Matrix4f result;
+
+    result.at(0, 3) = offset.x;
+    result.at(1, 3) = offset.y;
+    result.at(2, 3) = offset.z;
+
+    return result;
+}
+
+Matrix4f
+Matrix4f::frustum(double left, double right,
+                  double bottom, double top,
+                  double near_dist, double far_dist) {
+    Matrix4f result;
+
+    result.at(0, 0) = static_cast<float>(2.0 * near_dist / (right - left));
+    result.at(0, 2) = static_cast<float>((right + left) / (right - left));
+    result.at(1, 1) = static_cast<float>(2.0 * near_dist / (top - bottom));
+    result.at(1, 2) = static_cast<float>((top + bottom) / (top - bottom));
+    result.at(2, 2) = static_cast<float>(-(far_dist + near_dist) / (far_dist - near_dist));
+    result.at(2, 3) = static_cast<float>(-2.0 * far_dist * near_dist / (far_dist - near_dist));
+    result.at(3, 2) = -1.0f;
+    result.at(3, 3) =  0.0f;
+
+    return result;
+}
+
+float&
+Matrix4f::at(int row, int column) {
+    return m[column * 4 + row];
+}
+
+float
+Matrix4f::at(int row, int column) const {
+    return m[column * 4 + row];
+}
+
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Point.hpp"
+
+namespace mazemaze {
+
+// Column-major 4x4 matrix, laid out the way glLoadMatrixf and GLSL expect
+class Matrix4f {
+public:
+    Matrix4f();
+    ~Matrix4f();
+
+    Matrix4f operator*(const Matrix4f& other) const;
+    Pointf   transform_point(Pointf point) const;
+    Pointf   transform_direction(Pointf direction) const;
+
+    const float* data() const;
+
+    static Matrix4f rotation_x(float angle);
+    static Matrix4f rotation_y(float angle);
+    static Matrix4f rotation_z(float angle);
+    static Matrix4f translation(Pointf offset);
+    static Matrix4f frustum(double left, double right,
+                            double bottom, double top,
+                            double near_dist, double far_dist);
+
+private:
+    float m[16];
+
+    float& at(int row, int column);
+    float  at(int row, int column) const;
+};
+
+}
@@ -17,124 +17,246 @@
 
 #include "MazeRenderer.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <limits>
 
 #include <SFML/OpenGL.hpp>
+#include <SFML/System/Clock.hpp>
 
+#include "GpuResources.hpp"
 #include "GraphicEngine.hpp"
+#include "Camera.hpp"
 #include "Chunk.hpp"
 #include "Game.hpp"
 #include "Logger.hpp"
+#include "utils.hpp"
+#include "Settings.hpp"
 
 namespace mazemaze {
 
 MazeRenderer::MazeRenderer(Game& game) : maze(game.maze()),
+                                         cache(static_cast<std::size_t>(
+                                             game.settings().chunk_cache_size()
+                                         ) * 1024 * 1024),
+                                         visibility(maze, 720, Chunk::SIZE * 2),
+                                         lods { { std::numeric_limits<float>::infinity(), 96 } },
+                                         lod_hysteresis(1.0f),
+                                         fog_distance(std::numeric_limits<float>::infinity()),
                                          deleted(true),
-                                         old_hcp(-1, -1) {}
+                                         active(false),
+                                         baked(false),
+                                         chunk_meshes(true),
+                                         chunks_resource(GpuResources::inst().add(
+                                             [] () {},
+                                             [this] () { drop_chunks(); }
+                                         )),
+                                         rebuilding(false),
+                                         old_hcp(-1, -1),
+                                         prefetcher(maze, Chunk::SIZE * 3 / 2) {}
 
 MazeRenderer::~MazeRenderer() {
     if (!deleted)
         disable();
+
+    GpuResources::inst().remove(chunks_resource);
 }
 
 void
 MazeRenderer::enable() {
     int chunks_count = maze.chunks_count().x * maze.chunks_count().y;
 
-    visible  = new int[16] {-1};
-    compiled = new bool[chunks_count] {false};
-    draw_list = glGenLists(chunks_count);
+    visible = new int[16] {-1};
     old_hcp = Point2{-1, -1};
 
-    set_states();
-    on_enable();
+    cache.init(chunks_count, lods.size());
+    chunk_lods.assign(chunks_count, -1);
+    rebuilding = false;
 
-    GraphicEngine::inst().set_on_set_states_callback([this] {
-        this->set_states();
-    });
+    on_enable();
 
     deleted = false;
 }
 
 void
 MazeRenderer::disable() {
-    GraphicEngine::inst().set_on_set_states_callback([] {});
+    if (active)
+        deactivate();
 
     on_disable();
 
-    int chunk_count = maze.chunks_count().x * maze.chunks_count().y;
-
-    glDeleteLists(draw_list, chunk_count);
+    GpuResources::inst().release(chunks_resource);
+    cache.clear();
 
     delete [] visible;
-    delete [] compiled;
 
     deleted = true;
 }
 
+void
+MazeRenderer::activate() {
+    set_states();
+
+    GraphicEngine::inst().set_on_set_states_callback([this] {
+        this->set_states();
+    });
+
+    active = true;
+}
+
+void
+MazeRenderer::deactivate() {
+    GraphicEngine::inst().set_on_set_states_callback([] {});
+
+    reset_states();
+
+    active = false;
+}
+
+bool
+MazeRenderer::enabled() const {
+    return !deleted;
+}
+
 void
 MazeRenderer::tick(Game& game, float delta_time) {
-    bool force = false;
+    const RenderSnapshot& frame = game.snapshot();
 
-    Player& player = game.player();
+    if (!chunk_meshes) {
+        on_tick(delta_time);
+        update_stats();
+        return;
+    }
 
-    Point2i p(
-        static_cast<int>(player.position().x) / (Chunk::SIZE / 2),
-        static_cast<int>(player.position().z) / (Chunk::SIZE / 2)
-    );
+    cache.set_budget(static_cast<std::size_t>(frame.chunk_cache_size) * 1024 * 1024);
 
-    if (p != old_hcp || force) {
-        Logger::inst().log_debug("Re-enabling chunks.");
+    ensure_resources();
 
-        old_hcp = p;
+    update_baked(frame.baked_lighting);
+    update_window(frame.position);
 
-        for (int i = 0; i < 16; i++)
-            visible[i] = -1;
+    on_tick(delta_time);
 
-        if (p.x % 2 == 0) p.x--;
-        if (p.y % 2 == 0) p.y--;
+    prefetch(frame.position, frame.move_vector, delta_time);
 
-        p.x /= 2;
-        p.y /= 2;
+    update_stats();
+}
 
-        Point2i pe(p.x + 2, p.y + 2);
+void
+MazeRenderer::idle_tick(Game& game, float delta_time) {
+    const RenderSnapshot& frame = game.snapshot();
 
-        if (p.x < 0) p.x = 0;
-        if (p.y < 0) p.y = 0;
+    if (!chunk_meshes)
+        return;
 
-        auto& chunks_count = maze.chunks_count();
+    cache.set_budget(static_cast<std::size_t>(frame.inactive_cache_size) * 1024 * 1024);
+    cache.trim(visible, 16);
 
-        if (pe.x > chunks_count.x) pe.x = chunks_count.x;
-        if (pe.y > chunks_count.y) pe.y = chunks_count.y;
+    ensure_resources();
 
-        for (int i = p.x; i < pe.x; i++)
-            for (int j = p.y; j < pe.y; j++) {
-                int chunk_num = i + j * chunks_count.x;
+    update_baked(frame.baked_lighting);
+    update_window(frame.position);
 
-                enable_chunk(chunk_num);
-            }
-    }
+    // Inactive styles only get what is left of fast frames
+    if (delta_time > 1.0f / 30.0f)
+        return;
 
-    on_tick(delta_time);
+    const sf::Time time_budget = sf::milliseconds(1);
+
+    sf::Clock clock;
+
+    for (int i = 0; i < 16 && visible[i] != -1; i++) {
+        if (cache.resident_bytes() >= cache.budget() || clock.getElapsedTime() > time_budget)
+            return;
+
+        int lod = target_lod(chunk_distance(visible[i], frame.position));
+
+        if (!cache.compiled(visible[i], lod))
+            prepare_chunk(visible[i], lod);
+    }
 }
 
 void
-MazeRenderer::render() {
+MazeRenderer::render(const Camera& camera) {
+    struct Drawn {
+        int   num;
+        int   lod;
+        float distance;
+    };
+
+    Drawn drawn[16];
+    int drawn_count = 0;
     int chunks[16 + 1];
     int index = 0;
+    int culled = 0;
+    int occluded = 0;
+    int pending = 0;
 
-    chunks[16] = -1;
+    Frustum frustum = camera.frustum();
 
-    for (int i = 0; i < 16; i++) {
-        if (visible[i] != -1) {
-            chunks[index] = visible[i];
-            index++;
+    visibility.update(camera.position(), frustum);
+
+    for (int i = 0; i < 16 && visible[i] != -1; i++) {
+        Pointf min(
+            (visible[i] % maze.chunks_count().x) * Chunk::SIZE,
+            0.0f,
+            (visible[i] / maze.chunks_count().x) * Chunk::SIZE
+        );
+
+        Pointf max(min.x + Chunk::SIZE, 1.0f, min.z + Chunk::SIZE);
+
+        if (!frustum.intersects(min, max) || frustum.depth(min, max) > fog_distance) {
+            culled++;
+        } else if (!visibility.chunk_visible(visible[i])) {
+            occluded++;
         } else {
-            chunks[index] = -1;
-            break;
+            float distance = chunk_distance(visible[i], camera.position());
+
+            drawn[drawn_count] = Drawn { visible[i], select_lod(visible[i], distance), distance };
+            drawn_count++;
         }
     }
 
+    // After a context loss the chunks are compiled again over several
+    // frames, nearest first, so only distant ones are missing meanwhile
+    if (rebuilding)
+        std::sort(drawn, drawn + drawn_count, [] (const Drawn& a, const Drawn& b) {
+            return a.distance < b.distance;
+        });
+
+    sf::Clock rebuild_clock;
+    bool rebuilt = false;
+
+    for (int i = 0; i < drawn_count; i++) {
+        if (rebuilding && !cache.compiled(drawn[i].num, drawn[i].lod)) {
+            // The nearest missing chunk is always compiled, so the rebuild
+            // makes progress even when one chunk takes the whole budget
+            if (rebuilt && rebuild_clock.getElapsedTime() >= GpuResources::frame_budget()) {
+                pending++;
+                continue;
+            }
+
+            rebuilt = true;
+        }
+
+        prepare_chunk(drawn[i].num, drawn[i].lod);
+
+        chunks[index] = drawn[i].num;
+        index++;
+    }
+
+    chunks[index] = -1;
+
+    if (pending == 0)
+        rebuilding = false;
+
+    RenderStats& stats = GraphicEngine::inst().stats();
+
+    stats.drawn_chunks    = index;
+    stats.culled_chunks   = culled;
+    stats.occluded_chunks = occluded;
+
     render_chunks(chunks);
 }
 
@@ -142,6 +264,10 @@ void
 MazeRenderer::set_states() {
 }
 
+void
+MazeRenderer::reset_states() {
+}
+
 void
 MazeRenderer::on_enable() {
 }
@@ -150,10 +276,23 @@ void
 MazeRenderer::on_disable() {
 }
 
+void
+MazeRenderer::ensure_resources() {
+    GpuResources::inst().ensure(chunks_resource);
+}
+
+void
+MazeRenderer::drop_chunks() {
+    // Resident chunks are enabled again by the next window update
+    cache.clear();
+    old_hcp = Point2i(-1, -1);
+
+    rebuilding = true;
+}
+
 void
 MazeRenderer::enable_chunk(int num) {
-    if (!compiled[num])
-        compile_chunk(num);
+    cache.acquire(num);
 
     for (int i = 0; i < 16; i++) {
         if (visible[i] == -1) {
@@ -166,7 +305,244 @@ MazeRenderer::enable_chunk(int num) {
 void
 MazeRenderer::render_chunks(int chunks[]) {
     for (; *chunks != -1; chunks++)
-        glCallList(draw_list + *chunks);
+        render_chunk(*chunks);
+}
+
+void
+MazeRenderer::render_chunk(int num) {
+    glCallList(cache.list(num, chunk_lods[num]));
+    GraphicEngine::inst().stats().draw_calls++;
+}
+
+int
+MazeRenderer::chunk_lod(int num) const {
+    return chunk_lods[num];
+}
+
+void
+MazeRenderer::update_window(Pointf position) {
+    Point2i p(
+        static_cast<int>(position.x) / (Chunk::SIZE / 2),
+        static_cast<int>(position.z) / (Chunk::SIZE / 2)
+    );
+
+    if (p == old_hcp)
+        return;
+
+    Logger::inst().log_debug("Re-enabling chunks.");
+
+    old_hcp = p;
+
+    for (int i = 0; i < 16; i++)
+        visible[i] = -1;
+
+    Point2i start;
+    Point2i end;
+
+    chunks_window(p, start, end);
+
+    for (int i = start.x; i < end.x; i++)
+        for (int j = start.y; j < end.y; j++) {
+            int chunk_num = i + j * maze.chunks_count().x;
+
+            enable_chunk(chunk_num);
+        }
+
+    cache.trim(visible, 16);
+}
+
+void
+MazeRenderer::update_baked(bool baked) {
+    if (MazeRenderer::baked == baked)
+        return;
+
+    MazeRenderer::baked = baked;
+
+    // Baked light lives in the display lists, so everything is compiled
+    // again
+    int chunks_count = maze.chunks_count().x * maze.chunks_count().y;
+
+    on_disable();
+
+    cache.init(chunks_count, lods.size());
+    chunk_lods.assign(chunks_count, -1);
+    old_hcp = Point2i(-1, -1);
+
+    on_enable();
+}
+
+void
+MazeRenderer::chunk_extent(int num, Point2i& start, Point2i& end) {
+    const int size = Chunk::SIZE;
+
+    start = Point2i((num % maze.chunks_count().x) * size, (num / maze.chunks_count().x) * size);
+
+    // Chunks at the far edges are cut by the maze border
+    end = Point2i(std::min(size, maze.size().x - start.x), std::min(size, maze.size().y - start.y));
+}
+
+void
+MazeRenderer::chunks_window(Point2i hcp, Point2i& start, Point2i& end) {
+    if (hcp.x % 2 == 0) hcp.x--;
+    if (hcp.y % 2 == 0) hcp.y--;
+
+    hcp.x /= 2;
+    hcp.y /= 2;
+
+    end = Point2i(hcp.x + 2, hcp.y + 2);
+
+    if (hcp.x < 0) hcp.x = 0;
+    if (hcp.y < 0) hcp.y = 0;
+
+    start = hcp;
+
+    auto& chunks_count = maze.chunks_count();
+
+    if (end.x > chunks_count.x) end.x = chunks_count.x;
+    if (end.y > chunks_count.y) end.y = chunks_count.y;
+}
+
+void
+MazeRenderer::prefetch(Pointf position, Point2f move_vector, float delta_time) {
+    // Don't make a struggling frame even longer
+    if (delta_time > 1.0f / 30.0f)
+        return;
+
+    prefetcher.predict(position, move_vector);
+
+    const sf::Time time_budget = sf::milliseconds(2);
+
+    RenderStats& stats = GraphicEngine::inst().stats();
+    sf::Clock clock;
+    Point2i old_cell_hcp(-1, -1);
+
+    for (const auto& cell : prefetcher.cells()) {
+        Point2i hcp(cell.x / (Chunk::SIZE / 2), cell.y / (Chunk::SIZE / 2));
+
+        if (hcp == old_cell_hcp)
+            continue;
+
+        old_cell_hcp = hcp;
+
+        Point2i start;
+        Point2i end;
+
+        chunks_window(hcp, start, end);
+
+        Pointf cell_position(cell.x + 0.5f, 0.5f, cell.y + 0.5f);
+
+        for (int i = start.x; i < end.x; i++)
+            for (int j = start.y; j < end.y; j++) {
+                if (cache.resident_bytes() >= cache.budget() ||
+                        clock.getElapsedTime() > time_budget)
+                    return;
+
+                int num = i + j * maze.chunks_count().x;
+                int lod = target_lod(chunk_distance(num, cell_position));
+
+                if (cache.resident(num) && cache.compiled(num, lod))
+                    continue;
+
+                prepare_chunk(num, lod);
+
+                stats.prefetched_chunks++;
+            }
+    }
+}
+
+float
+MazeRenderer::chunk_distance(int num, Pointf position) {
+    Point2f min(
+        (num % maze.chunks_count().x) * Chunk::SIZE,
+        (num / maze.chunks_count().x) * Chunk::SIZE
+    );
+
+    Point2f max(min.x + Chunk::SIZE, min.y + Chunk::SIZE);
+
+    Point2f delta(
+        position.x - std::max(min.x, std::min(position.x, max.x)),
+        position.z - std::max(min.y, std::min(position.z, max.y))
+    );
+
+    return std::hypot(delta.x, delta.y);
+}
+
+int
+MazeRenderer::target_lod(float distance) const {
+    for (int i = 0; i < static_cast<int>(lods.size()); i++)
+        if (distance < lods[i].distance)
+            return i;
+
+    return lods.size() - 1;
+}
+
+int
+MazeRenderer::select_lod(int num, float distance) {
+    int& lod = chunk_lods[num];
+    int target = target_lod(distance);
+
+    if (lod < 0)
+        lod = target;
+
+    else if (target > lod && distance > lods[target - 1].distance + lod_hysteresis)
+        lod = target;
+
+    else if (target < lod && distance < lods[target].distance - lod_hysteresis)
+        lod = target;
+
+    return lod;
+}
+
+void
+MazeRenderer::prepare_chunk(int num, int lod) {
+    cache.acquire(num);
+
+    if (cache.compiled(num, lod))
+        return;
+
+    glNewList(cache.list(num, lod), GL_COMPILE);
+    compile_chunk(num, lod);
+    glEndList();
+
+    cache.set_compiled(num, lod, chunk_bytes(num, lod));
+
+    GraphicEngine::inst().stats().compiled_chunks++;
+}
+
+std::size_t
+MazeRenderer::chunk_bytes(int num, int lod) {
+    Point2i pos;
+    Point2i end;
+    Point2i i;
+
+    chunk_extent(num, pos, end);
+
+    std::size_t faces = 0;
+
+    for (i.x = pos.x; i.x < pos.x + end.x; i.x++)
+        for (i.y = pos.y; i.y < pos.y + end.y; i.y++) {
+            faces++;
+
+            if (maze.get_opened(i))
+                for (int side = 0; side < 4; side++) {
+                    Point2i d;
+
+                    side_to_coords(side, d.x, d.y);
+
+                    faces += !maze.get_opened(Point2i(i.x + d.x, i.y + d.y));
+                }
+        }
+
+    return faces * lods[lod].face_bytes;
+}
+
+void
+MazeRenderer::update_stats() {
+    RenderStats& stats = GraphicEngine::inst().stats();
+
+    stats.resident_chunks = cache.resident_count();
+    stats.resident_bytes  = cache.resident_bytes();
+    stats.chunks_budget   = cache.budget();
 }
 
 }
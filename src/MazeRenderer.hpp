@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2018-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -17,13 +17,22 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
+#include "CellVisibility.hpp"
+#include "ChunkCache.hpp"
 #include "ITickable.hpp"
+#include "Point.hpp"
 #include "Point2.hpp"
+#include "Prefetcher.hpp"
 
 namespace mazemaze {
 
 class Maze;
 class Game;
+class Camera;
+class Frustum;
 
 class MazeRenderer : public ITickable<Game&> {
 public:
@@ -32,27 +41,68 @@ public:
 
     void enable();
     void disable();
+    void activate();
+    void deactivate();
+    bool enabled() const;
     void tick(Game& game, float delta_time) override;
-    void render();
+    void idle_tick(Game& game, float delta_time);
+    virtual void render(const Camera& camera);
     virtual void render_sky() = 0;
+    virtual const char* name() const = 0;
 
 protected:
+    struct Lod {
+        float distance;
+        std::size_t face_bytes;
+    };
+
     int* visible;
     Maze& maze;
-    bool* compiled;
-    unsigned int draw_list;
+    ChunkCache cache;
+    CellVisibility visibility;
+    std::vector<Lod> lods;
+    float lod_hysteresis;
+    float fog_distance;
     bool deleted;
+    bool active;
+    bool baked;
+    // False for styles that draw the maze without chunk display lists
+    bool chunk_meshes;
 
     virtual void set_states();
+    virtual void reset_states();
     virtual void on_enable();
     virtual void on_disable();
     virtual void on_tick(float delta_time) = 0;
     virtual void enable_chunk(int num);
-    virtual void compile_chunk(int num) = 0;
+    virtual void compile_chunk(int num, int lod) = 0;
     virtual void render_chunks(int chunks[]);
+    virtual void render_chunk(int num);
+    virtual void ensure_resources();
+
+    // First cell of a chunk and how many cells it spans from there
+    void chunk_extent(int num, Point2i& start, Point2i& end);
+
+    int chunk_lod(int num) const;
 
 private:
+    int chunks_resource;
+    bool rebuilding;
     Point2i old_hcp;
+    std::vector<int> chunk_lods;
+    Prefetcher prefetcher;
+
+    void drop_chunks();
+    void update_window(Pointf position);
+    void update_baked(bool baked);
+    void chunks_window(Point2i hcp, Point2i& start, Point2i& end);
+    void prefetch(Pointf position, Point2f move_vector, float delta_time);
+    float chunk_distance(int num, Pointf position);
+    int  target_lod(float distance) const;
+    int  select_lod(int num, float distance);
+    void prepare_chunk(int num, int lod);
+    std::size_t chunk_bytes(int num, int lod);
+    void update_stats();
 };
 
 }
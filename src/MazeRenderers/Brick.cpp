@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -17,17 +17,21 @@
 
 #include "Brick.hpp"
 
+#include <cmath>
+#include <limits>
+
 #include <SFML/OpenGL.hpp>
 
+#include "../GpuResources.hpp"
 #include "../Logger.hpp"
+#include "../MeshCache.hpp"
 #include "../utils.hpp"
 #include "../Chunk.hpp"
 #include "../Game.hpp"
+#include "../GlState.hpp"
 #include "../Camera.hpp"
 #include "../path_separator.hpp"
 
-#include <OBJ_Loader.h>
-
 namespace mazemaze {
 namespace renderers {
 
@@ -36,43 +40,89 @@ Brick::Brick(Game& game) :
         game(game),
         mesh_count(10),
         skybox(50, 0.5f, 0.5f, 0.5f),
-        mesh_draw_list(-1) {}
+        mesh_draw_list(-1),
+        mesh_rotations(1),
+        walls_resource(GpuResources::inst().add(
+            [this] () { compile_walls(); },
+            [this] () { release_walls(); }
+        )) {
+    lods = {
+        { 5.0f,                                     160 },
+        { std::numeric_limits<float>::infinity(), 96  }
+    };
+
+    lighting.sun_direction = Pointf(0.5f , 0.75f, 0.25f);
+    lighting.sun_diffuse   = Pointf(0.5f , 0.45f, 0.4f);
+    lighting.sun_ambient   = Pointf(0.33f, 0.4f , 0.5f);
+
+    lighting.torch = true;
+    lighting.torch_diffuse = Pointf(0.25f, 0.225f, 0.2f);
+    lighting.torch_constant_attenuation = 0.4f;
+    lighting.torch_linear_attenuation   = 0.2f;
+
+    lighting.fog = true;
+    lighting.fog_color = Pointf(0.5f, 0.5f, 0.5f);
+
+    set_fog_density(0.5f);
+}
 
-Brick::~Brick() = default;
+Brick::~Brick() {
+    GpuResources::inst().remove(walls_resource);
+}
+
+const char*
+Brick::name() const {
+    return "Brick";
+}
 
 void
 Brick::compile_walls() {
     Logger::inst().log_debug("Compiling walls.");
 
-    objl::Loader loader = objl::Loader();
-    loader.LoadFile("data" PATH_SEPARATOR "wall.obj");
+    const char* source_path = "data" PATH_SEPARATOR "wall.obj";
+    const char* cache_path  = "data" PATH_SEPARATOR "wall.mesh";
+
+    MeshCache walls;
+
+    if (!walls.load(cache_path, source_path)) {
+        Logger::inst().log_debug("Wall mesh cache is missing or stale, parsing OBJ.");
+
+        if (!walls.load_source(source_path))
+            Logger::inst().log_error(fmt("Can't load %s.", source_path));
+
+        else if (!walls.save(cache_path, source_path))
+            Logger::inst().log_debug(fmt("Can't write %s.", cache_path));
+    }
 
     if (mesh_draw_list != -1)
-        glDeleteLists(mesh_draw_list, mesh_count);
+        glDeleteLists(mesh_draw_list, mesh_count * mesh_rotations);
 
-    mesh_draw_list = glGenLists(mesh_count);
+    // Baked sun light depends on which way a wall faces, so every mesh is
+    // compiled once per rotation
+    mesh_rotations = baked ? 4 : 1;
+    mesh_draw_list = glGenLists(mesh_count * mesh_rotations);
 
-    for (auto& mesh : loader.LoadedMeshes) {
+    for (auto& mesh : walls.meshes()) {
         bool initialized = false;
         bool side = false;
         Angle angle_type;
 
-        if (mesh.MeshName == "flat") {
+        if (mesh.name == "flat") {
             angle_type = Angle::NO;
             initialized = true;
-        } else if (mesh.MeshName == "inner_left") {
+        } else if (mesh.name == "inner_left") {
             angle_type = Angle::INNER;
             side = false;
             initialized = true;
-        } else if (mesh.MeshName == "inner_right") {
+        } else if (mesh.name == "inner_right") {
             angle_type = Angle::INNER;
             side = true;
             initialized = true;
-        } else if (mesh.MeshName == "outer_left") {
+        } else if (mesh.name == "outer_left") {
             angle_type = Angle::OUTER;
             side = false;
             initialized = true;
-        } else if (mesh.MeshName == "outer_right") {
+        } else if (mesh.name == "outer_right") {
             angle_type = Angle::OUTER;
             side = true;
             initialized = true;
@@ -81,47 +131,64 @@ Brick::compile_walls() {
         }
 
         if (initialized) {
-            compile_wall(mesh, angle_type, false, side);
-            compile_wall(mesh, angle_type, true,  side);
+            for (int rotation = 0; rotation < mesh_rotations; rotation++) {
+                compile_wall(mesh, angle_type, false, side, rotation);
+                compile_wall(mesh, angle_type, true,  side, rotation);
+            }
         }
     }
 }
 
 void
-Brick::compile_wall(objl::Mesh& mesh, Angle angle_type, bool v_mirror, bool side) {
+Brick::release_walls() {
+    if (mesh_draw_list != -1)
+        glDeleteLists(mesh_draw_list, mesh_count * mesh_rotations);
+
+    mesh_draw_list = -1;
+}
+
+void
+Brick::compile_wall(const MeshCache::Mesh& mesh, Angle angle_type, bool v_mirror, bool side,
+                    int rotation) {
+    Matrix4f rotation_matrix = Matrix4f::rotation_y(rotation * static_cast<float>(M_PI_2));
+    LightBaker baker(lighting, maze, Point2i(0, 0), baked);
+    Pointf albedo(0.42f, 0.2f, 0.16f);
+
     float y_coeff;
     int j, j_end, j_step;
 
     if (v_mirror) {
         y_coeff = -1.0f;
-        j = mesh.Indices.size() - 1; j_end = -1; j_step = -1;
+        j = mesh.vertices_count - 1; j_end = -1; j_step = -1;
     } else {
         y_coeff = 1.0f;
-        j = 0; j_end = mesh.Indices.size(); j_step = 1;
+        j = 0; j_end = mesh.vertices_count; j_step = 1;
     }
 
-    glNewList(get_mesh(angle_type, v_mirror, side), GL_COMPILE);
+    glNewList(get_mesh(angle_type, v_mirror, side, rotation), GL_COMPILE);
 
     glBegin(GL_TRIANGLES);
-    glColor3f(0.42f, 0.2f, 0.16f);
+    glColor3f(albedo.x, albedo.y, albedo.z);
 
     for (; j != j_end; j += j_step) {
-        objl::Vertex vertex = mesh.Vertices[mesh.Indices[j]];
+        const float* vertex = mesh.vertices + j * MeshCache::VERTEX_FLOATS;
+        Pointf normal(vertex[3], vertex[4] * y_coeff, vertex[5]);
 
-        glNormal3f(vertex.Normal.X, vertex.Normal.Y * y_coeff, vertex.Normal.Z);
+        if (baked)
+            baker.color(albedo, rotation_matrix.transform_direction(normal));
 
-        glVertex3f(vertex.Position.X,
-                   vertex.Position.Y * y_coeff,
-                   vertex.Position.Z);
+        glNormal3f(normal.x, normal.y, normal.z);
+        glVertex3f(vertex[0], vertex[1] * y_coeff, vertex[2]);
     }
 
-    draw_mortar(angle_type, side);
+    draw_mortar(angle_type, side, baker, rotation_matrix);
 
     glEndList();
 }
 
 void
-Brick::draw_mortar(Brick::Angle angle_type, bool side) {
+Brick::draw_mortar(Brick::Angle angle_type, bool side,
+                   const LightBaker& baker, const Matrix4f& rotation) {
     float x_start = 0.0f;
     float x_end = 0.0f;
     float x_offset;
@@ -153,7 +220,11 @@ Brick::draw_mortar(Brick::Angle angle_type, bool side) {
 
     x_end *= -1.0f;
 
-    glColor3f(0.375f, 0.375f, 0.375f);
+    if (baked)
+        baker.color(Pointf(0.375f, 0.375f, 0.375f),
+                    rotation.transform_direction(Pointf(0.0f, 0.0f, 1.0f)));
+    else
+        glColor3f(0.375f, 0.375f, 0.375f);
 
     glNormal3f(0.0f, 0.0f, 1.0f);
 
@@ -171,11 +242,13 @@ Brick::draw_mortar(Brick::Angle angle_type, bool side) {
 }
 
 unsigned int
-Brick::get_mesh(Brick::Angle angle_type, bool v_mirror, bool side) {
+Brick::get_mesh(Brick::Angle angle_type, bool v_mirror, bool side, int rotation) {
+    int first = mesh_draw_list + (rotation % mesh_rotations) * mesh_count;
+
     if (angle_type == Angle::NO)
-        return mesh_draw_list + v_mirror * (mesh_count / 2);
+        return first + v_mirror * (mesh_count / 2);
 
-    return mesh_draw_list + 1 + (angle_type - 1) * 2 + side + v_mirror * (mesh_count / 2);
+    return first + 1 + (angle_type - 1) * 2 + side + v_mirror * (mesh_count / 2);
 }
 
 Brick::Angle
@@ -187,95 +260,120 @@ Brick::get_angle(bool openeds[]) {
 }
 
 void
-Brick::render_wall(Angle left_angle, Angle right_angle, bool flip) {
+Brick::render_wall(Angle left_angle, Angle right_angle, bool flip, int rotation) {
     glTranslatef(-0.5f, 0.0f, 0.0f);
-    glCallList(get_mesh(left_angle, flip, false));
+    glCallList(get_mesh(left_angle, flip, false, rotation));
 
     if (right_angle == Angle::NO)
         glTranslatef(0.5f, 0.0f, 0.0f);
 
-    glCallList(get_mesh(right_angle, flip, true));
+    glCallList(get_mesh(right_angle, flip, true, rotation));
 }
 
 void
 Brick::set_states() {
-    glEnable(GL_LIGHT0);
-    glEnable(GL_LIGHT1);
+    GlState& gl_state = GlState::inst();
+
+    // With baked chunks the sun is already in the vertex colours and only
+    // the camera light stays live on top of them
+    float ambient[] = { 0.2f, 0.2f, 0.2f, 1.0f };
+    float baked_ambient[] = { 1.0f, 1.0f, 1.0f, 1.0f };
 
-    float light0_diffuse[] = { 0.5f , 0.45f, 0.4f };
-    float light0_ambient[] = { 0.33f, 0.4f , 0.5f };
+    gl_state.light_model(GL_LIGHT_MODEL_AMBIENT, baked ? baked_ambient : ambient);
+
+    if (baked)
+        gl_state.disable(GL_LIGHT0);
+    else
+        gl_state.enable(GL_LIGHT0);
+
+    gl_state.enable(GL_LIGHT1);
+
+    float light0_diffuse[] = { 0.5f , 0.45f, 0.4f, 1.0f };
+    float light0_ambient[] = { 0.33f, 0.4f , 0.5f, 1.0f };
     float light0_position[] = { 0.5f, 0.75f, 0.25f, 0.0f };
 
-    glLightfv(GL_LIGHT0, GL_DIFFUSE, light0_diffuse);
-    glLightfv(GL_LIGHT0, GL_AMBIENT, light0_ambient);
-    glLightfv(GL_LIGHT0, GL_POSITION, light0_position);
+    gl_state.light(GL_LIGHT0, GL_DIFFUSE, light0_diffuse);
+    gl_state.light(GL_LIGHT0, GL_AMBIENT, light0_ambient);
+    gl_state.light(GL_LIGHT0, GL_POSITION, light0_position);
 
-    float light1_diffuse[] = { 0.25f, 0.225f, 0.2f };
-    float light1_ambient[] = { 0.0f , 0.0f  , 0.0f };
+    float light1_diffuse[] = { 0.25f, 0.225f, 0.2f, 1.0f };
+    float light1_ambient[] = { 0.0f , 0.0f  , 0.0f, 1.0f };
 
-    glLightfv(GL_LIGHT1, GL_DIFFUSE, light1_diffuse);
-    glLightfv(GL_LIGHT1, GL_AMBIENT, light1_ambient);
+    gl_state.light(GL_LIGHT1, GL_DIFFUSE, light1_diffuse);
+    gl_state.light(GL_LIGHT1, GL_AMBIENT, light1_ambient);
 
-    glLightf(GL_LIGHT1, GL_CONSTANT_ATTENUATION, 0.4f);
-    glLightf(GL_LIGHT1, GL_LINEAR_ATTENUATION, 0.2f);
+    gl_state.light(GL_LIGHT1, GL_CONSTANT_ATTENUATION, 0.4f);
+    gl_state.light(GL_LIGHT1, GL_LINEAR_ATTENUATION, 0.2f);
 
     float fog_color[4] = { 0.5f, 0.5f, 0.5f, 1.0f };
-    float fog_density = 0.5f;
 
-    glFogfv(GL_FOG_COLOR, fog_color);
-    glFogi(GL_FOG_MODE, GL_EXP);
-    glFogf(GL_FOG_DENSITY, fog_density);
-    glFogf(GL_FOG_START, 0);
-    glFogf(GL_FOG_END, 10.0f);
+    gl_state.fog(GL_FOG_COLOR, fog_color);
+    gl_state.fog(GL_FOG_MODE, GL_EXP);
+    gl_state.fog(GL_FOG_DENSITY, fog_density);
+    gl_state.fog(GL_FOG_START, 0);
+    gl_state.fog(GL_FOG_END, 10.0f);
 }
 
 void
 Brick::on_enable() {
-    compile_walls();
+    GpuResources::inst().ensure(walls_resource);
+}
+
+void
+Brick::reset_states() {
+    GlState& gl_state = GlState::inst();
+
+    gl_state.disable(GL_LIGHT0);
+    gl_state.disable(GL_LIGHT1);
 }
 
 void
 Brick::on_disable() {
-    glDisable(GL_LIGHT0);
-    glDisable(GL_LIGHT1);
+    GpuResources::inst().release(walls_resource);
+}
 
-    if (mesh_draw_list != -1)
-        glDeleteLists(mesh_draw_list, mesh_count);
+void
+Brick::ensure_resources() {
+    MazeRenderer::ensure_resources();
+
+    // Chunk lists call the wall lists, so these come back before any chunk
+    GpuResources::inst().ensure(walls_resource);
+}
+
+void
+Brick::compile_chunk(int num, int lod) {
+    if (lod == 0)
+        compile_bricks(num);
+    else
+        compile_flat(num);
 }
 
 void
-Brick::compile_chunk(int num) {
-    Point2i end(Chunk::SIZE, Chunk::SIZE);
+Brick::compile_bricks(int num) {
+    Point2i pos;
+    Point2i end;
     Point2i i;
-    Point2i pos(
-        (num % maze.chunks_count().x) * Chunk::SIZE,
-        (num / maze.chunks_count().x) * Chunk::SIZE
-    );
+
+    chunk_extent(num, pos, end);
 
     Logger::inst().log_debug(fmt("Compiling chunk %d at %d %d.", num, pos.x, pos.y));
 
-    glNewList(draw_list + num, GL_COMPILE);
+    LightBaker baker(lighting, maze, pos, baked);
 
     glPushMatrix();
 
     glTranslatef(pos.x, 0.0, pos.y);
 
-    if (pos.x + Chunk::SIZE > maze.size().x)
-        end.x = maze.size().x % Chunk::SIZE;
-
-    if (pos.y + Chunk::SIZE > maze.size().y)
-        end.y = maze.size().y % Chunk::SIZE;
-
     for (i.x = 0; i.x < end.x; i.x++)
         for (i.y = 0; i.y < end.y; i.y++) {
-            glColor3f (0.4f, 0.4f, 0.4f);
-            glNormal3f(0.0f, 1.0f, 0.0f);
+            baker.albedo(0.4f, 0.4f, 0.4f);
+            baker.normal(0.0f, 1.0f, 0.0f);
 
             glBegin(GL_QUADS);
-            glVertex3i(i.x,     0, i.y);
-            glVertex3i(i.x,     0, i.y + 1);
-            glVertex3i(i.x + 1, 0, i.y + 1);
-            glVertex3i(i.x + 1, 0, i.y);
+            baker.vertex(i.x,     0, i.y);
+            baker.vertex(i.x,     0, i.y + 1);
+            baker.vertex(i.x + 1, 0, i.y + 1);
+            baker.vertex(i.x + 1, 0, i.y);
             glEnd();
 
             if (maze.get_opened(Point2i(i.x + pos.x, i.y + pos.y))) {
@@ -304,7 +402,7 @@ Brick::compile_chunk(int num) {
                         { opened[2], tmp_opened[0] }
                     };
 
-                    render_wall(get_angle(angles[0]), get_angle(angles[1]), true);
+                    render_wall(get_angle(angles[0]), get_angle(angles[1]), true, 3);
                     glPopMatrix();
                 }
 
@@ -323,7 +421,7 @@ Brick::compile_chunk(int num) {
                         { opened[3], tmp_opened[1] }
                     };
 
-                    render_wall(get_angle(angles[0]), get_angle(angles[1]), true);
+                    render_wall(get_angle(angles[0]), get_angle(angles[1]), true, 1);
                     glPopMatrix();
                 }
 
@@ -341,7 +439,7 @@ Brick::compile_chunk(int num) {
                         { opened[1], tmp_opened[1] }
                     };
 
-                    render_wall(get_angle(angles[0]), get_angle(angles[1]), false);
+                    render_wall(get_angle(angles[0]), get_angle(angles[1]), false, 2);
                     glPopMatrix();
                 }
 
@@ -356,7 +454,7 @@ Brick::compile_chunk(int num) {
                         { opened[0], tmp_opened[0] }
                     };
 
-                    render_wall(get_angle(angles[0]), get_angle(angles[1]), false);
+                    render_wall(get_angle(angles[0]), get_angle(angles[1]), false, 0);
                 }
 
                 glPopMatrix();
@@ -364,10 +462,90 @@ Brick::compile_chunk(int num) {
         }
 
     glPopMatrix();
+}
 
-    glEndList();
+void
+Brick::compile_flat(int num) {
+    Point2i pos;
+    Point2i end;
+    Point2i i;
+
+    chunk_extent(num, pos, end);
 
-    compiled[num] = true;
+    Logger::inst().log_debug(fmt("Compiling flat chunk %d at %d %d.", num, pos.x, pos.y));
+
+    LightBaker baker(lighting, maze, pos, baked);
+
+    glPushMatrix();
+
+    glTranslatef(pos.x, 0.0, pos.y);
+
+    glBegin(GL_QUADS);
+
+    for (i.x = 0; i.x < end.x; i.x++)
+        for (i.y = 0; i.y < end.y; i.y++) {
+            baker.albedo(0.4f, 0.4f, 0.4f);
+            baker.normal(0.0f, 1.0f, 0.0f);
+
+            baker.vertex(i.x,     0, i.y);
+            baker.vertex(i.x,     0, i.y + 1);
+            baker.vertex(i.x + 1, 0, i.y + 1);
+            baker.vertex(i.x + 1, 0, i.y);
+
+            if (!maze.get_opened(Point2i(i.x + pos.x, i.y + pos.y)))
+                continue;
+
+            baker.albedo(0.41f, 0.23f, 0.19f);
+
+            if (!maze.get_opened(Point2i(i.x + 1 + pos.x, i.y + pos.y))) {
+                baker.normal(-1.0f, 0.0f, 0.0f);
+
+                baker.vertex(i.x + 1, 0, i.y + 1);
+                baker.vertex(i.x + 1, 1, i.y + 1);
+                baker.vertex(i.x + 1, 1, i.y);
+                baker.vertex(i.x + 1, 0, i.y);
+            }
+
+            if (!maze.get_opened(Point2i(i.x - 1 + pos.x, i.y + pos.y))) {
+                baker.normal(1.0f, 0.0f, 0.0f);
+
+                baker.vertex(i.x, 0, i.y);
+                baker.vertex(i.x, 1, i.y);
+                baker.vertex(i.x, 1, i.y + 1);
+                baker.vertex(i.x, 0, i.y + 1);
+            }
+
+            if (!maze.get_opened(Point2i(i.x + pos.x, i.y + 1 + pos.y))) {
+                baker.normal(0.0f, 0.0f, -1.0f);
+
+                baker.vertex(i.x,     0, i.y + 1);
+                baker.vertex(i.x,     1, i.y + 1);
+                baker.vertex(i.x + 1, 1, i.y + 1);
+                baker.vertex(i.x + 1, 0, i.y + 1);
+            }
+
+            if (!maze.get_opened(Point2i(i.x + pos.x, i.y - 1 + pos.y))) {
+                baker.normal(0.0f, 0.0f, 1.0f);
+
+                baker.vertex(i.x + 1, 0, i.y);
+                baker.vertex(i.x + 1, 1, i.y);
+                baker.vertex(i.x,     1, i.y);
+                baker.vertex(i.x,     0, i.y);
+            }
+        }
+
+    glEnd();
+
+    glPopMatrix();
+}
+
+void
+Brick::set_fog_density(float fog_density) {
+    Brick::fog_density = fog_density;
+    lighting.fog_density = fog_density;
+
+    // GL_EXP fog is fully opaque once it is below one colour step
+    fog_distance = std::log(255.0f) / fog_density;
 }
 
 void
@@ -376,19 +554,30 @@ Brick::on_tick(float) {
 
 void
 Brick::render_chunks(int chunks[]) {
-    const auto& position = game.player().camera().position();
+    lighting.baked = baked;
+
+    if (LightingShader::inst().bind(lighting, game.snapshot().camera)) {
+        MazeRenderer::render_chunks(chunks);
+        LightingShader::inst().unbind();
+
+        return;
+    }
+
+    GlState& gl_state = GlState::inst();
+
+    const auto& position = game.snapshot().camera.position();
 
     float light1_position[] = { position.x, position.y, position.z, 1.0f };
 
-    glLightfv(GL_LIGHT1, GL_POSITION, light1_position);
+    gl_state.light(GL_LIGHT1, GL_POSITION, light1_position);
 
-    glEnable(GL_FOG);
-    glEnable(GL_LIGHTING);
+    gl_state.enable(GL_FOG);
+    gl_state.enable(GL_LIGHTING);
 
     MazeRenderer::render_chunks(chunks);
 
-    glDisable(GL_LIGHTING);
-    glDisable(GL_FOG);
+    gl_state.disable(GL_LIGHTING);
+    gl_state.disable(GL_FOG);
 }
 
 void
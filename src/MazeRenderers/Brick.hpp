@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -17,15 +17,13 @@
 
 #pragma once
 
+#include "../LightBaker.hpp"
+#include "../LightingShader.hpp"
+#include "../Matrix4.hpp"
 #include "../MazeRenderer.hpp"
+#include "../MeshCache.hpp"
 #include "../Skybox.hpp"
 
-namespace objl {
-
-class Mesh;
-
-}
-
 namespace mazemaze {
 
 class Game;
@@ -37,8 +35,14 @@ public:
     explicit Brick(Game& game);
     ~Brick() override;
 
+    const char* name() const override;
+
 protected:
     Game& game;
+    float fog_density;
+    Lighting lighting;
+
+    void set_fog_density(float fog_density);
 
 private:
     enum Angle {
@@ -51,22 +55,30 @@ private:
 
     Skybox skybox;
     int mesh_draw_list;
+    int mesh_rotations;
+    int walls_resource;
 
     void compile_walls();
-    void compile_wall(objl::Mesh& mesh, Angle angle_type, bool v_mirror, bool side);
-    void draw_mortar(Angle angle_type, bool side);
-    unsigned int get_mesh(Angle angle_type, bool v_mirror, bool side);
+    void release_walls();
+    void compile_wall(const MeshCache::Mesh& mesh, Angle angle_type, bool v_mirror, bool side,
+                      int rotation);
+    void draw_mortar(Angle angle_type, bool side, const LightBaker& baker, const Matrix4f& rotation);
+    unsigned int get_mesh(Angle angle_type, bool v_mirror, bool side, int rotation);
 
     Angle get_angle(bool openeds[]);
 
     void set_states() override;
+    void reset_states() override;
     void on_enable() override;
     void on_disable() override;
-    void compile_chunk(int num) override;
+    void ensure_resources() override;
+    void compile_chunk(int num, int lod) override;
+    void compile_bricks(int num);
+    void compile_flat(int num);
     void on_tick(float deltaTime) override;
     void render_chunks(int chunks[]) override;
     void render_sky() override;
-    void render_wall(Angle left_angle, Angle right_angle, bool flip);
+    void render_wall(Angle left_angle, Angle right_angle, bool flip, int rotation);
 };
 
 }
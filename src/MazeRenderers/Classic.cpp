@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -35,18 +35,20 @@ Classic::Classic(Game& game) :
 
 Classic::~Classic() = default;
 
+const char*
+Classic::name() const {
+    return "Classic";
+}
+
 void
-Classic::compile_chunk(int num) {
-    Point2i end(Chunk::SIZE, Chunk::SIZE);
+Classic::compile_chunk(int num, int) {
+    Point2i pos;
+    Point2i end;
     Point2i i;
-    Point2i pos(
-        (num % maze.chunks_count().x) * Chunk::SIZE,
-        (num / maze.chunks_count().x) * Chunk::SIZE
-    );
 
-    Logger::inst().log_debug(fmt("Compiling chunk %d at %d %d.", num, pos.x, pos.y));
+    chunk_extent(num, pos, end);
 
-    glNewList(draw_list + num, GL_COMPILE);
+    Logger::inst().log_debug(fmt("Compiling chunk %d at %d %d.", num, pos.x, pos.y));
 
     glPushMatrix();
 
@@ -56,12 +58,6 @@ Classic::compile_chunk(int num) {
 
     glColor3f(1.0f, 0.0f, 1.0f);
 
-    if (pos.x + Chunk::SIZE > maze.size().x)
-        end.x = maze.size().x % Chunk::SIZE;
-
-    if (pos.y + Chunk::SIZE > maze.size().y)
-        end.y = maze.size().y % Chunk::SIZE;
-
     glVertex3i(0,     0, end.y);
     glVertex3i(end.x, 0, end.y);
     glVertex3i(end.x, 0, 0);
@@ -117,15 +113,11 @@ Classic::compile_chunk(int num) {
     glEnd();
 
     glPopMatrix();
-
-    glEndList();
-
-    compiled[num] = true;
 }
 
 void
 Classic::on_tick(float) {
-    star_sky.set_time(game.time());
+    star_sky.set_time(game.snapshot().time);
 }
 
 void
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -31,11 +31,13 @@ public:
     explicit Classic(Game& game);
     ~Classic() override;
 
+    const char* name() const override;
+
 private:
     StarSky star_sky;
     Game& game;
 
-    void compile_chunk(int num) override;
+    void compile_chunk(int num, int lod) override;
     void on_tick(float delta_time) override;
     void render_sky() override;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -23,6 +23,8 @@
 #include "../utils.hpp"
 #include "../Chunk.hpp"
 #include "../Game.hpp"
+#include "../GlState.hpp"
+#include "../LightBaker.hpp"
 #include "../Camera.hpp"
 
 namespace mazemaze {
@@ -31,32 +33,45 @@ namespace renderers {
 Gray::Gray(Game& game) :
         MazeRenderer(game),
         game(game),
-        skybox(50, 0.67f, 0.85f, 1.0f) {}
+        skybox(50, 0.67f, 0.85f, 1.0f) {
+    lighting.sun_direction = Pointf(0.5f, 0.75f, 0.25f);
+    lighting.sun_diffuse   = Pointf(1.0f, 0.9f , 0.8f);
+    lighting.sun_ambient   = Pointf(0.5f, 0.55f, 0.75f);
+}
 
 Gray::~Gray() = default;
 
+const char*
+Gray::name() const {
+    return "Gray";
+}
+
 void
 Gray::set_states() {
-    glEnable(GL_LIGHT0);
+    GlState& gl_state = GlState::inst();
+
+    float ambient[] = { 0.2f, 0.2f, 0.2f, 1.0f };
+
+    gl_state.light_model(GL_LIGHT_MODEL_AMBIENT, ambient);
+    gl_state.enable(GL_LIGHT0);
 }
 
 void
-Gray::on_disable() {
-    glDisable(GL_LIGHT0);
+Gray::reset_states() {
+    GlState::inst().disable(GL_LIGHT0);
 }
 
 void
-Gray::compile_chunk(int num) {
-    Point2i end(Chunk::SIZE, Chunk::SIZE);
+Gray::compile_chunk(int num, int) {
+    Point2i pos;
+    Point2i end;
     Point2i i;
-    Point2i pos(
-        (num % maze.chunks_count().x) * Chunk::SIZE,
-        (num / maze.chunks_count().x) * Chunk::SIZE
-    );
+
+    chunk_extent(num, pos, end);
 
     Logger::inst().log_debug(fmt("Compiling chunk %d at %d %d.", num, pos.x, pos.y));
 
-    glNewList(draw_list + num, GL_COMPILE);
+    LightBaker baker(lighting, maze, pos, baked);
 
     glPushMatrix();
 
@@ -64,75 +79,79 @@ Gray::compile_chunk(int num) {
 
     glBegin(GL_QUADS);
 
-    glColor3f(0.5f, 0.5f, 0.5f);
-
-    if (pos.x + Chunk::SIZE > maze.size().x)
-        end.x = maze.size().x % Chunk::SIZE;
+    baker.albedo(0.5f, 0.5f, 0.5f);
 
-    if (pos.y + Chunk::SIZE > maze.size().y)
-        end.y = maze.size().y % Chunk::SIZE;
+    baker.normal(0.0f, 1.0f, 0.0f);
 
-    glNormal3f(0.0f, 1.0f, 0.0f);
+    // Baked occlusion needs a vertex at every cell corner
+    if (baked) {
+        for (i.x = 0; i.x < end.x; i.x++)
+            for (i.y = 0; i.y < end.y; i.y++) {
+                if (!maze.get_opened(Point2i(i.x + pos.x, i.y + pos.y)))
+                    continue;
 
-    glVertex3i(0,     0, end.y);
-    glVertex3i(end.x, 0, end.y);
-    glVertex3i(end.x, 0, 0);
-    glVertex3i(0,     0, 0);
+                baker.vertex(i.x,     0, i.y + 1);
+                baker.vertex(i.x + 1, 0, i.y + 1);
+                baker.vertex(i.x + 1, 0, i.y);
+                baker.vertex(i.x,     0, i.y);
+            }
+    } else {
+        baker.vertex(0,     0, end.y);
+        baker.vertex(end.x, 0, end.y);
+        baker.vertex(end.x, 0, 0);
+        baker.vertex(0,     0, 0);
+    }
 
     for (i.x = 0; i.x < end.x; i.x++)
         for (i.y = 0; i.y < end.y; i.y++)
             if (maze.get_opened(Point2i(i.x + pos.x, i.y + pos.y))) {
                 if (!maze.get_opened(Point2i(i.x + 1 + pos.x, i.y + pos.y))) {
-                    glNormal3f(-1.0f, 0.0f, 0.0f);
+                    baker.normal(-1.0f, 0.0f, 0.0f);
 
-                    glVertex3i(i.x + 1, 0, i.y + 1);
-                    glVertex3i(i.x + 1, 1, i.y + 1);
-                    glVertex3i(i.x + 1, 1, i.y);
-                    glVertex3i(i.x + 1, 0, i.y);
+                    baker.vertex(i.x + 1, 0, i.y + 1);
+                    baker.vertex(i.x + 1, 1, i.y + 1);
+                    baker.vertex(i.x + 1, 1, i.y);
+                    baker.vertex(i.x + 1, 0, i.y);
                 }
 
                 if (!maze.get_opened(Point2i(i.x - 1 + pos.x, i.y + pos.y))) {
-                    glNormal3f(1.0f, 0.0f, 0.0f);
+                    baker.normal(1.0f, 0.0f, 0.0f);
 
-                    glVertex3i(i.x, 0, i.y);
-                    glVertex3i(i.x, 1, i.y);
-                    glVertex3i(i.x, 1, i.y + 1);
-                    glVertex3i(i.x, 0, i.y + 1);
+                    baker.vertex(i.x, 0, i.y);
+                    baker.vertex(i.x, 1, i.y);
+                    baker.vertex(i.x, 1, i.y + 1);
+                    baker.vertex(i.x, 0, i.y + 1);
                 }
 
                 if (!maze.get_opened(Point2i(i.x + pos.x, i.y + 1 + pos.y))) {
-                    glNormal3f(0.0f, 0.0f, -1.0f);
+                    baker.normal(0.0f, 0.0f, -1.0f);
 
-                    glVertex3i(i.x, 0, i.y + 1);
-                    glVertex3i(i.x, 1, i.y + 1);
-                    glVertex3i(i.x + 1, 1, i.y + 1);
-                    glVertex3i(i.x + 1, 0, i.y + 1);
+                    baker.vertex(i.x, 0, i.y + 1);
+                    baker.vertex(i.x, 1, i.y + 1);
+                    baker.vertex(i.x + 1, 1, i.y + 1);
+                    baker.vertex(i.x + 1, 0, i.y + 1);
                 }
 
                 if (!maze.get_opened(Point2i(i.x + pos.x, i.y - 1 + pos.y))) {
-                    glNormal3f(0.0f, 0.0f, 1.0f);
+                    baker.normal(0.0f, 0.0f, 1.0f);
 
-                    glVertex3i(i.x + 1, 0, i.y);
-                    glVertex3i(i.x + 1, 1, i.y);
-                    glVertex3i(i.x, 1, i.y);
-                    glVertex3i(i.x, 0, i.y);
+                    baker.vertex(i.x + 1, 0, i.y);
+                    baker.vertex(i.x + 1, 1, i.y);
+                    baker.vertex(i.x, 1, i.y);
+                    baker.vertex(i.x, 0, i.y);
                 }
             } else {
-                glNormal3f(0.0f, 1.0f, 0.0f);
+                baker.normal(0.0f, 1.0f, 0.0f);
 
-                glVertex3i(i.x, 1, i.y);
-                glVertex3i(i.x, 1, i.y + 1);
-                glVertex3i(i.x + 1, 1, i.y + 1);
-                glVertex3i(i.x + 1, 1, i.y);
+                baker.vertex(i.x, 1, i.y);
+                baker.vertex(i.x, 1, i.y + 1);
+                baker.vertex(i.x + 1, 1, i.y + 1);
+                baker.vertex(i.x + 1, 1, i.y);
             }
 
     glEnd();
 
     glPopMatrix();
-
-    glEndList();
-
-    compiled[num] = true;
 }
 
 void
@@ -141,17 +160,32 @@ Gray::on_tick(float) {
 
 void
 Gray::render_chunks(int chunks[]) {
-    float light0_diffuse[]  = { 1.0f, 0.9f , 0.8f };
-    float light0_ambient[]  = { 0.5f, 0.55f, 0.75f };
+    // Everything Gray lights is static, baked chunks need no lighting at all
+    if (baked) {
+        MazeRenderer::render_chunks(chunks);
+        return;
+    }
+
+    if (LightingShader::inst().bind(lighting, game.snapshot().camera)) {
+        MazeRenderer::render_chunks(chunks);
+        LightingShader::inst().unbind();
+
+        return;
+    }
+
+    GlState& gl_state = GlState::inst();
+
+    float light0_diffuse[]  = { 1.0f, 0.9f , 0.8f, 1.0f };
+    float light0_ambient[]  = { 0.5f, 0.55f, 0.75f, 1.0f };
     float light0_position[] = { 0.5f, 0.75f, 0.25f, 0.0f };
 
-    glLightfv(GL_LIGHT0, GL_DIFFUSE, light0_diffuse);
-    glLightfv(GL_LIGHT0, GL_AMBIENT, light0_ambient);
-    glLightfv(GL_LIGHT0, GL_POSITION, light0_position);
+    gl_state.light(GL_LIGHT0, GL_DIFFUSE, light0_diffuse);
+    gl_state.light(GL_LIGHT0, GL_AMBIENT, light0_ambient);
+    gl_state.light(GL_LIGHT0, GL_POSITION, light0_position);
 
-    glEnable(GL_LIGHTING);
+    gl_state.enable(GL_LIGHTING);
     MazeRenderer::render_chunks(chunks);
-    glDisable(GL_LIGHTING);
+    gl_state.disable(GL_LIGHTING);
 }
 
 void
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "../LightingShader.hpp"
 #include "../MazeRenderer.hpp"
 #include "../Skybox.hpp"
 
@@ -31,13 +32,16 @@ public:
     explicit Gray(Game& game);
     ~Gray() override;
 
+    const char* name() const override;
+
 private:
     Game& game;
     Skybox skybox;
+    Lighting lighting;
 
     void set_states() override;
-    void on_disable() override;
-    void compile_chunk(int num) override;
+    void reset_states() override;
+    void compile_chunk(int num, int lod) override;
     void on_tick(float delta_time) override;
     void render_chunks(int chunks[]) override;
     void render_sky() override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -22,6 +22,7 @@
 #include "../Logger.hpp"
 #include "../utils.hpp"
 #include "../Game.hpp"
+#include "../GlState.hpp"
 #include "../Camera.hpp"
 
 namespace mazemaze {
@@ -29,60 +30,160 @@ namespace renderers {
 
 NightBrick::NightBrick(mazemaze::Game& game) :
     Brick(game),
-    starSky(1024, 0.0f, Rotation(1.5f, 0.7f, 0.0f)) {}
+    starSky(1024, 0.0f, Rotation(1.5f, 0.7f, 0.0f)),
+    torches(maze, 3.5f, 40),
+    shaded(false) {
+    lighting.sun_diffuse = Pointf(0.35f, 0.4f  , 0.45f);
+    lighting.sun_ambient = Pointf(0.05f, 0.055f, 0.06f);
+
+    lighting.torch_diffuse = Pointf(0.3f, 0.2f, 0.175f);
+    lighting.torch_constant_attenuation = 0.8f;
+    lighting.torch_linear_attenuation   = 1.0f;
+
+    lighting.wall_torch_diffuse = Pointf(0.9f, 0.55f, 0.25f);
+    lighting.wall_torch_quadratic_attenuation = 1.5f;
+
+    lighting.fog_color = Pointf(0.0f, 0.0f, 0.0f);
+
+    set_fog_density(0.25f);
+}
+
+const char*
+NightBrick::name() const {
+    return "Night Brick";
+}
 
 void
 NightBrick::on_tick(float) {
-    starSky.set_time(game.time());
+    starSky.set_time(game.snapshot().time);
 }
 
 void
 NightBrick::set_states() {
-    glEnable(GL_LIGHT0);
-    glEnable(GL_LIGHT1);
+    GlState& gl_state = GlState::inst();
 
-    float light0_diffuse[]  = { 0.35f, 0.4f  , 0.45f };
-    float light0_ambient[]  = { 0.05f, 0.055f, 0.06f };
+    // With baked chunks the sun is already in the vertex colours and only
+    // the camera light stays live on top of them
+    float ambient[] = { 0.2f, 0.2f, 0.2f, 1.0f };
+    float baked_ambient[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    gl_state.light_model(GL_LIGHT_MODEL_AMBIENT, baked ? baked_ambient : ambient);
+
+    if (baked)
+        gl_state.disable(GL_LIGHT0);
+    else
+        gl_state.enable(GL_LIGHT0);
+
+    gl_state.enable(GL_LIGHT1);
+
+    float light0_diffuse[]  = { 0.35f, 0.4f  , 0.45f, 1.0f };
+    float light0_ambient[]  = { 0.05f, 0.055f, 0.06f, 1.0f };
     float light0_position[] = { 0.5f , 0.75f , 0.25f, 0.0f};
 
-    glLightfv(GL_LIGHT0, GL_DIFFUSE, light0_diffuse);
-    glLightfv(GL_LIGHT0, GL_AMBIENT, light0_ambient);
-    glLightfv(GL_LIGHT0, GL_POSITION, light0_position);
+    gl_state.light(GL_LIGHT0, GL_DIFFUSE, light0_diffuse);
+    gl_state.light(GL_LIGHT0, GL_AMBIENT, light0_ambient);
+    gl_state.light(GL_LIGHT0, GL_POSITION, light0_position);
+
+    float light1_diffuse[] = { 0.3f, 0.2f, 0.175f, 1.0f };
+    float light1_ambient[] = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+    gl_state.light(GL_LIGHT1, GL_DIFFUSE, light1_diffuse);
+    gl_state.light(GL_LIGHT1, GL_AMBIENT, light1_ambient);
+
+    gl_state.light(GL_LIGHT1, GL_CONSTANT_ATTENUATION, 0.8f);
+    gl_state.light(GL_LIGHT1, GL_LINEAR_ATTENUATION, 1.0f);
 
-    float light1_diffuse[] = { 0.3f, 0.2f, 0.175f };
-    float light1_ambient[] = { 0.0f, 0.0f, 0.0f };
+    // Wall torches take the remaining lights, they are enabled per chunk
+    float torch_diffuse[] = { 0.9f, 0.55f, 0.25f, 1.0f };
+    float torch_ambient[] = { 0.0f, 0.0f , 0.0f , 1.0f };
 
-    glLightfv(GL_LIGHT1, GL_DIFFUSE, light1_diffuse);
-    glLightfv(GL_LIGHT1, GL_AMBIENT, light1_ambient);
+    for (int i = 0; i < LightingShader::MAX_WALL_TORCHES; i++) {
+        GLenum light = GL_LIGHT2 + i;
 
-    glLightf(GL_LIGHT1, GL_CONSTANT_ATTENUATION, 0.8f);
-    glLightf(GL_LIGHT1, GL_LINEAR_ATTENUATION, 1.0f);
+        gl_state.light(light, GL_DIFFUSE, torch_diffuse);
+        gl_state.light(light, GL_AMBIENT, torch_ambient);
+
+        gl_state.light(light, GL_CONSTANT_ATTENUATION, 1.0f);
+        gl_state.light(light, GL_LINEAR_ATTENUATION, 0.0f);
+        gl_state.light(light, GL_QUADRATIC_ATTENUATION, 1.5f);
+    }
 
     float fogColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
-    float g_FogDensity = 0.25f;
 
-    glFogfv(GL_FOG_COLOR, fogColor);
-    glFogi(GL_FOG_MODE, GL_EXP);
-    glFogf(GL_FOG_DENSITY, g_FogDensity);
-    glFogf(GL_FOG_START, 0);
-    glFogf(GL_FOG_END, 10.0f);
+    gl_state.fog(GL_FOG_COLOR, fogColor);
+    gl_state.fog(GL_FOG_MODE, GL_EXP);
+    gl_state.fog(GL_FOG_DENSITY, fog_density);
+    gl_state.fog(GL_FOG_START, 0);
+    gl_state.fog(GL_FOG_END, 10.0f);
+}
+
+void
+NightBrick::reset_states() {
+    GlState& gl_state = GlState::inst();
+
+    for (int i = 0; i < 2 + LightingShader::MAX_WALL_TORCHES; i++)
+        gl_state.disable(GL_LIGHT0 + i);
 }
 
 void
 NightBrick::render_chunks(int chunks[]) {
-    const auto& position = game.player().camera().position();
+    lighting.baked = baked;
+
+    shaded = LightingShader::inst().bind(lighting, game.snapshot().camera);
+
+    if (shaded) {
+        MazeRenderer::render_chunks(chunks);
+        LightingShader::inst().unbind();
+
+        return;
+    }
+
+    GlState& gl_state = GlState::inst();
+
+    const auto& position = game.snapshot().camera.position();
 
     float light1_position[] = { position.x, position.y, position.z, 1.0f };
 
-    glLightfv(GL_LIGHT1, GL_POSITION, light1_position);
+    gl_state.light(GL_LIGHT1, GL_POSITION, light1_position);
 
-    glEnable(GL_FOG);
-    glEnable(GL_LIGHTING);
+    gl_state.enable(GL_FOG);
+    gl_state.enable(GL_LIGHTING);
 
     MazeRenderer::render_chunks(chunks);
 
-    glDisable(GL_LIGHTING);
-    glDisable(GL_FOG);
+    gl_state.disable(GL_LIGHTING);
+    gl_state.disable(GL_FOG);
+}
+
+void
+NightBrick::render_chunk(int num) {
+    const Camera& camera = game.snapshot().camera;
+
+    Pointf lights[LightingShader::MAX_WALL_TORCHES];
+    int count = torches.nearest(num, camera.position(), lights,
+                                LightingShader::MAX_WALL_TORCHES);
+
+    if (shaded) {
+        LightingShader::inst().set_wall_torches(lights, count, camera);
+    } else {
+        GlState& gl_state = GlState::inst();
+
+        // The modelview holds the camera here, so positions end up right
+        for (int i = 0; i < LightingShader::MAX_WALL_TORCHES; i++) {
+            GLenum light = GL_LIGHT2 + i;
+
+            if (i < count) {
+                float position[] = { lights[i].x, lights[i].y, lights[i].z, 1.0f };
+
+                gl_state.enable(light);
+                gl_state.light(light, GL_POSITION, position);
+            } else {
+                gl_state.disable(light);
+            }
+        }
+    }
+
+    MazeRenderer::render_chunk(num);
 }
 
 void
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -19,6 +19,7 @@
 
 #include "Brick.hpp"
 
+#include "../LightGrid.hpp"
 #include "../StarSky.hpp"
 
 namespace mazemaze {
@@ -32,12 +33,18 @@ class NightBrick : public Brick
 public:
     explicit NightBrick(Game& game);
 
+    const char* name() const override;
+
 private:
     StarSky starSky;
+    LightGrid torches;
+    bool shaded;
 
     void on_tick(float delta_time) override;
     void set_states() override;
+    void reset_states() override;
     void render_chunks(int chunks[]) override;
+    void render_chunk(int num) override;
     void render_sky() override;
 };
 
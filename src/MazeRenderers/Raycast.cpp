@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Raycast.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <SFML/OpenGL.hpp>
+
+#include "../Camera.hpp"
+#include "../Game.hpp"
+#include "../GlState.hpp"
+#include "../GraphicEngine.hpp"
+#include "../LightBaker.hpp"
+
+namespace mazemaze {
+namespace renderers {
+
+// Software GL slows down with big uploads more than with a blurry image
+static const int max_height = 540;
+
+// Screen columns per job handed to the workers
+static const int band_width = 32;
+
+Raycast::Raycast(Game& game) :
+        MazeRenderer(game),
+        game(game),
+        texture(0),
+        size(0, 0) {
+    lighting.sun_direction = Pointf(0.5f, 0.75f, 0.25f);
+    lighting.sun_diffuse   = Pointf(1.0f, 0.9f , 0.8f);
+    lighting.sun_ambient   = Pointf(0.5f, 0.55f, 0.75f);
+
+    // Walls are cast every frame, nothing goes through the chunk cache
+    chunk_meshes = false;
+    lods = { { std::numeric_limits<float>::infinity(), 0 } };
+
+    LightBaker baker(lighting, maze, Point2i(0, 0), true);
+    Pointf albedo(0.5f, 0.5f, 0.5f);
+
+    auto color = [] (Pointf color) {
+        return Color {
+            static_cast<std::uint8_t>(color.x * 255.0f),
+            static_cast<std::uint8_t>(color.y * 255.0f),
+            static_cast<std::uint8_t>(color.z * 255.0f),
+            255
+        };
+    };
+
+    sky_color   = color(Pointf(0.67f, 0.85f, 1.0f));
+    floor_color = color(baker.lit(albedo, Pointf(0.0f, 1.0f, 0.0f)));
+
+    face_colors[0] = color(baker.lit(albedo, Pointf(-1.0f, 0.0f,  0.0f)));
+    face_colors[1] = color(baker.lit(albedo, Pointf( 1.0f, 0.0f,  0.0f)));
+    face_colors[2] = color(baker.lit(albedo, Pointf( 0.0f, 0.0f, -1.0f)));
+    face_colors[3] = color(baker.lit(albedo, Pointf( 0.0f, 0.0f,  1.0f)));
+}
+
+Raycast::~Raycast() = default;
+
+const char*
+Raycast::name() const {
+    return "Raycast";
+}
+
+void
+Raycast::render(const Camera& camera) {
+    // Casting is the expensive part here, so it follows dynamic resolution
+    // even when there is no scene target to scale the image
+    resize(GraphicEngine::inst().maze_pass_size());
+
+    cast(camera);
+    present();
+
+    RenderStats& stats = GraphicEngine::inst().stats();
+
+    stats.drawn_chunks    = 0;
+    stats.culled_chunks   = 0;
+    stats.occluded_chunks = 0;
+    stats.draw_calls++;
+}
+
+void
+Raycast::on_enable() {
+    // Only started once the style is used, so other styles don't keep
+    // idle threads around
+    workers = std::make_unique<WorkerPool>(WorkerPool::default_size());
+
+    glGenTextures(1, &texture);
+
+    size = Point2i(0, 0);
+}
+
+void
+Raycast::on_disable() {
+    glDeleteTextures(1, &texture);
+
+    texture = 0;
+    pixels.clear();
+
+    workers.reset();
+}
+
+void
+Raycast::compile_chunk(int, int) {
+}
+
+void
+Raycast::on_tick(float) {
+}
+
+void
+Raycast::render_sky() {
+}
+
+void
+Raycast::resize(Point2i window_size) {
+    int scale = std::max(1, (window_size.y + max_height - 1) / max_height);
+
+    Point2i new_size(std::max(1, window_size.x / scale), std::max(1, window_size.y / scale));
+
+    if (new_size == size)
+        return;
+
+    size = new_size;
+    pixels.assign(size.x * size.y, sky_color);
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size.x, size.y, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void
+Raycast::cast(const Camera& camera) {
+    View view;
+
+    float yaw = camera.rotation().yaw();
+    float tan_half_fov = std::tan(camera.fov() * (M_PI / 360.0));
+
+    // Camera looks down -Z, so these are the view rotation's rows
+    view.position = camera.position();
+    view.forward  = Point2f(std::sin(yaw), -std::cos(yaw));
+    view.right    = Point2f(std::cos(yaw) * tan_half_fov, std::sin(yaw) * tan_half_fov);
+    view.focal    = size.x * 0.5f / tan_half_fov;
+
+    // Pitch only shears the image vertically, which holds up well enough
+    // for the range the mouse allows
+    view.horizon  = size.y * 0.5f - view.focal * std::tan(camera.rotation().pitch());
+
+    int bands = (size.x + band_width - 1) / band_width;
+
+    workers->run(bands, [this, &view] (int band) {
+        int end = std::min(size.x, (band + 1) * band_width);
+
+        for (int x = band * band_width; x < end; x++)
+            cast_column(x, view);
+    });
+}
+
+void
+Raycast::cast_column(int x, const View& view) {
+    float u = 2.0f * (x + 0.5f) / size.x - 1.0f;
+
+    Point2f direction(view.forward.x + view.right.x * u,
+                      view.forward.y + view.right.y * u);
+
+    Point2i cell(static_cast<int>(std::floor(view.position.x)),
+                 static_cast<int>(std::floor(view.position.z)));
+
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    Point2f delta(direction.x == 0.0f ? infinity : std::abs(1.0f / direction.x),
+                  direction.y == 0.0f ? infinity : std::abs(1.0f / direction.y));
+
+    Point2i step(direction.x < 0.0f ? -1 : 1, direction.y < 0.0f ? -1 : 1);
+
+    Point2f side(
+        (direction.x < 0.0f ? view.position.x - cell.x : cell.x + 1 - view.position.x) * delta.x,
+        (direction.y < 0.0f ? view.position.z - cell.y : cell.y + 1 - view.position.z) * delta.y
+    );
+
+    const Point2i& maze_size = maze.size();
+
+    // Distance along the view direction, not along the ray, so walls
+    // don't bulge towards the screen edges
+    float distance = infinity;
+    int face = -1;
+
+    for (;;) {
+        if (side.x < side.y) {
+            distance = side.x;
+            side.x += delta.x;
+            cell.x += step.x;
+            face = step.x > 0 ? 0 : 1;
+        } else {
+            distance = side.y;
+            side.y += delta.y;
+            cell.y += step.y;
+            face = step.y > 0 ? 2 : 3;
+        }
+
+        // Once a ray leaves the maze it can't come back
+        if (cell.x < 0 || cell.x >= maze_size.x || cell.y < 0 || cell.y >= maze_size.y) {
+            face = -1;
+            break;
+        }
+
+        if (!maze.get_opened(cell))
+            break;
+    }
+
+    float top    = view.horizon;
+    float bottom = view.horizon;
+
+    if (face != -1) {
+        top    -= view.focal * (1.0f - view.position.y) / distance;
+        bottom += view.focal * view.position.y / distance;
+    }
+
+    auto row = [this] (float y) {
+        return static_cast<int>(std::max(0.0f, std::min(std::ceil(y), static_cast<float>(size.y))));
+    };
+
+    int wall_top    = row(top);
+    int wall_bottom = row(bottom);
+
+    Color* pixel = &pixels[x];
+
+    for (int y = 0; y < wall_top; y++, pixel += size.x)
+        *pixel = sky_color;
+
+    if (face != -1)
+        for (int y = wall_top; y < wall_bottom; y++, pixel += size.x)
+            *pixel = face_colors[face];
+
+    for (int y = wall_bottom; y < size.y; y++, pixel += size.x)
+        *pixel = floor_color;
+}
+
+void
+Raycast::present() {
+    GlState& gl_state = GlState::inst();
+
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    gl_state.disable(GL_DEPTH_TEST);
+    gl_state.enable(GL_TEXTURE_2D);
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size.x, size.y,
+                    GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+    glColor3f(1.0f, 1.0f, 1.0f);
+
+    // The image is stored top row first
+    glBegin(GL_QUADS);
+    glTexCoord2f(0.0f, 1.0f); glVertex2f(-1.0f, -1.0f);
+    glTexCoord2f(1.0f, 1.0f); glVertex2f( 1.0f, -1.0f);
+    glTexCoord2f(1.0f, 0.0f); glVertex2f( 1.0f,  1.0f);
+    glTexCoord2f(0.0f, 0.0f); glVertex2f(-1.0f,  1.0f);
+    glEnd();
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    gl_state.disable(GL_TEXTURE_2D);
+    gl_state.enable(GL_DEPTH_TEST);
+
+    glPopMatrix();
+
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+
+    glMatrixMode(GL_MODELVIEW);
+}
+
+}
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../LightingShader.hpp"
+#include "../MazeRenderer.hpp"
+#include "../WorkerPool.hpp"
+
+namespace mazemaze {
+
+class Game;
+
+namespace renderers {
+
+// Casts one ray per screen column through the maze cells on the CPU and
+// shows the result as a single texture, so machines with software GL only
+// upload one image per frame instead of rasterising every chunk.
+class Raycast : public MazeRenderer {
+public:
+    explicit Raycast(Game& game);
+    ~Raycast() override;
+
+    const char* name() const override;
+
+    void render(const Camera& camera) override;
+
+private:
+    struct Color {
+        std::uint8_t r, g, b, a;
+    };
+
+    struct View {
+        Pointf  position;
+        Point2f forward;
+        Point2f right;
+        float   focal;
+        float   horizon;
+    };
+
+    Game& game;
+    std::unique_ptr<WorkerPool> workers;
+    Lighting lighting;
+
+    unsigned int texture;
+    Point2i size;
+    std::vector<Color> pixels;
+
+    Color sky_color;
+    Color floor_color;
+    Color face_colors[4];
+
+    void on_enable() override;
+    void on_disable() override;
+    void compile_chunk(int num, int lod) override;
+    void on_tick(float delta_time) override;
+    void render_sky() override;
+
+    void resize(Point2i window_size);
+    void cast(const Camera& camera);
+    void cast_column(int x, const View& view);
+    void present();
+};
+
+}
+}
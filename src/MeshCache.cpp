@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MeshCache.hpp"
+
+#include <cstring>
+#include <fstream>
+
+#include <sys/stat.h>
+
+#if defined _WIN32 || defined __CYGWIN__
+# define MAZEMAZE_NO_MMAP
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+#include <OBJ_Loader.h>
+
+namespace mazemaze {
+
+static const char MAGIC[4] { 'M', 'Z', 'M', 'C' };
+
+MeshCache::MeshCache() :
+        mapping(nullptr),
+        mapping_size(0) {}
+
+MeshCache::~MeshCache() {
+    clear();
+}
+
+bool
+MeshCache::load(const std::string& path, const std::string& source_path) {
+    clear();
+
+#ifdef MAZEMAZE_NO_MMAP
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+    if (!file)
+        return false;
+
+    mapping_size = static_cast<std::size_t>(file.tellg());
+
+    storage.resize((mapping_size + sizeof(float) - 1) / sizeof(float));
+
+    file.seekg(0);
+
+    if (!file.read(reinterpret_cast<char*>(storage.data()), mapping_size)) {
+        clear();
+        return false;
+    }
+
+    const char* data = reinterpret_cast<const char*>(storage.data());
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd < 0)
+        return false;
+
+    struct stat file_stat;
+
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size < static_cast<off_t>(sizeof(Header))) {
+        close(fd);
+        return false;
+    }
+
+    mapping_size = static_cast<std::size_t>(file_stat.st_size);
+    mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        mapping_size = 0;
+        return false;
+    }
+
+    const char* data = static_cast<const char*>(mapping);
+#endif
+
+    Header header;
+
+    if (mapping_size < sizeof(Header)) {
+        clear();
+        return false;
+    }
+
+    std::memcpy(&header, data, sizeof(Header));
+
+    std::uint64_t source_size;
+    std::int64_t  source_mtime;
+
+    bool valid = std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+                 header.version == VERSION &&
+                 sizeof(Header) + header.meshes_count * sizeof(Entry) <= mapping_size;
+
+    // Without the source there is nothing to be stale against
+    if (valid && source_stamp(source_path, source_size, source_mtime))
+        valid = header.source_size == source_size && header.source_mtime == source_mtime;
+
+    for (std::uint32_t i = 0; valid && i < header.meshes_count; i++) {
+        Entry entry;
+
+        std::memcpy(&entry, data + sizeof(Header) + i * sizeof(Entry), sizeof(Entry));
+
+        std::uint64_t bytes = std::uint64_t(entry.vertices_count) * VERTEX_FLOATS * sizeof(float);
+
+        if (entry.offset % sizeof(float) != 0 || entry.offset + bytes > mapping_size) {
+            valid = false;
+            break;
+        }
+
+        entry.name[sizeof(entry.name) - 1] = '\0';
+
+        m_meshes.push_back(Mesh {
+            entry.name,
+            reinterpret_cast<const float*>(data + entry.offset),
+            entry.vertices_count
+        });
+    }
+
+    if (!valid)
+        clear();
+
+    return valid;
+}
+
+bool
+MeshCache::load_source(const std::string& source_path) {
+    clear();
+
+    objl::Loader loader;
+
+    if (!loader.LoadFile(source_path))
+        return false;
+
+    std::vector<std::size_t> offsets;
+
+    for (auto& mesh : loader.LoadedMeshes) {
+        offsets.push_back(storage.size());
+
+        for (unsigned int index : mesh.Indices) {
+            const objl::Vertex& vertex = mesh.Vertices[index];
+
+            storage.insert(storage.end(), {
+                vertex.Position.X, vertex.Position.Y, vertex.Position.Z,
+                vertex.Normal.X,   vertex.Normal.Y,   vertex.Normal.Z
+            });
+        }
+    }
+
+    for (std::size_t i = 0; i < loader.LoadedMeshes.size(); i++) {
+        auto& mesh = loader.LoadedMeshes[i];
+
+        m_meshes.push_back(Mesh {
+            mesh.MeshName,
+            storage.data() + offsets[i],
+            static_cast<std::uint32_t>(mesh.Indices.size())
+        });
+    }
+
+    return true;
+}
+
+bool
+MeshCache::save(const std::string& path, const std::string& source_path) const {
+    Header header {};
+
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.meshes_count = m_meshes.size();
+
+    if (!source_stamp(source_path, header.source_size, header.source_mtime))
+        return false;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if (!file)
+        return false;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+
+    std::uint64_t offset = sizeof(Header) + m_meshes.size() * sizeof(Entry);
+
+    for (const auto& mesh : m_meshes) {
+        Entry entry {};
+
+        std::strncpy(entry.name, mesh.name.c_str(), sizeof(entry.name) - 1);
+        entry.offset = offset;
+        entry.vertices_count = mesh.vertices_count;
+
+        file.write(reinterpret_cast<const char*>(&entry), sizeof(Entry));
+
+        offset += std::uint64_t(mesh.vertices_count) * VERTEX_FLOATS * sizeof(float);
+    }
+
+    for (const auto& mesh : m_meshes)
+        file.write(reinterpret_cast<const char*>(mesh.vertices),
+                   mesh.vertices_count * VERTEX_FLOATS * sizeof(float));
+
+    return static_cast<bool>(file);
+}
+
+void
+MeshCache::clear() {
+#ifndef MAZEMAZE_NO_MMAP
+    if (mapping)
+        munmap(mapping, mapping_size);
+#endif
+
+    mapping = nullptr;
+    mapping_size = 0;
+
+    m_meshes.clear();
+    storage.clear();
+}
+
+const std::vector<MeshCache::Mesh>&
+MeshCache::meshes() const {
+    return m_meshes;
+}
+
+bool
+MeshCache::convert(const std::string& source_path, const std::string& path) {
+    MeshCache cache;
+
+    return cache.load_source(source_path) && cache.save(path, source_path);
+}
+
+bool
+MeshCache::source_stamp(const std::string& source_path,
+                        std::uint64_t& size, std::int64_t& mtime) {
+    struct stat source_stat;
+
+    if (stat(source_path.c_str(), &source_stat) != 0)
+        return false;
+
+    size  = static_cast<std::uint64_t>(source_stat.st_size);
+    mtime = static_cast<std::int64_t>(source_stat.st_mtime);
+
+    return true;
+}
+
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mazemaze {
+
+// Binary, pre-triangulated copy of an OBJ file. Vertices are stored in draw
+// order as interleaved position and normal, so loading is a single mmap.
+class MeshCache {
+public:
+    struct Mesh {
+        std::string name;
+        const float* vertices;
+        std::uint32_t vertices_count;
+    };
+
+    static const int VERTEX_FLOATS = 6;
+
+    explicit MeshCache();
+    ~MeshCache();
+
+    MeshCache(const MeshCache&) = delete;
+    MeshCache& operator=(const MeshCache&) = delete;
+
+    bool load(const std::string& path, const std::string& source_path);
+    bool load_source(const std::string& source_path);
+    bool save(const std::string& path, const std::string& source_path) const;
+    void clear();
+
+    const std::vector<Mesh>& meshes() const;
+
+    static bool convert(const std::string& source_path, const std::string& path);
+
+private:
+    struct Header {
+        char          magic[4];
+        std::uint32_t version;
+        std::uint64_t source_size;
+        std::int64_t  source_mtime;
+        std::uint32_t meshes_count;
+        std::uint32_t reserved;
+    };
+
+    struct Entry {
+        char          name[32];
+        std::uint64_t offset;
+        std::uint32_t vertices_count;
+        std::uint32_t reserved;
+    };
+
+    static const std::uint32_t VERSION = 1;
+
+    std::vector<Mesh> m_meshes;
+    std::vector<float> storage;
+
+    void* mapping;
+    std::size_t mapping_size;
+
+    static bool source_stamp(const std::string& source_path,
+                             std::uint64_t& size, std::int64_t& mtime);
+};
+
+}
@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Minimap.hpp"
+
+#include <cmath>
+#include <limits>
+
+#include <SFML/OpenGL.hpp>
+
+#include "GlState.hpp"
+#include "GpuResources.hpp"
+#include "GraphicEngine.hpp"
+#include "Maze.hpp"
+#include "utils.hpp"
+
+namespace mazemaze {
+
+static const int chunk_size = Chunk::SIZE;
+
+// How far along a straight corridor the player sees
+static const int view_distance = 8;
+
+// Cells visible around the player at each zoom level, the last one hides
+// the map. Anything past SLOTS / 2 - 1 chunks would show the other side of
+// the ring.
+static const float zoom_radii[] = { 24.0f, 96.0f, 0.0f };
+
+Minimap::Minimap(Maze& maze) :
+        maze(maze),
+        seed(0),
+        texture(0),
+        texture_resource(GpuResources::inst().add(
+            [this] () { create_texture(); },
+            [this] () { delete_texture(); }
+        )),
+        zoom_level(0) {
+    for (int level = 0; level < LEVELS; level++) {
+        int size = SIZE >> level;
+
+        levels[level].assign(size * size, Texel {0, 0, 0, 0});
+    }
+
+    reset();
+}
+
+Minimap::~Minimap() {
+    GpuResources::inst().remove(texture_resource);
+}
+
+void
+Minimap::tick(Pointf position) {
+    if (maze.seed() != seed)
+        reset();
+
+    Point2i cell(static_cast<int>(std::floor(position.x)),
+                 static_cast<int>(std::floor(position.z)));
+
+    if (cell == old_cell)
+        return;
+
+    old_cell = cell;
+
+    Point2i chunk(cell.x / chunk_size, cell.y / chunk_size);
+
+    if (chunk != old_chunk) {
+        follow(chunk);
+        old_chunk = chunk;
+    }
+
+    explore(cell);
+}
+
+void
+Minimap::render(Pointf position, float yaw) {
+    GpuResources::inst().ensure(texture_resource);
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+
+    upload();
+
+    if (zoom_radii[zoom_level] > 0.0f)
+        draw(position, yaw, zoom_radii[zoom_level]);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void
+Minimap::zoom() {
+    zoom_level = (zoom_level + 1) % (sizeof(zoom_radii) / sizeof(zoom_radii[0]));
+}
+
+void
+Minimap::reset() {
+    seed = maze.seed();
+
+    explored.clear();
+
+    old_cell  = Point2i(-1, -1);
+    old_chunk = Point2i(-1, -1);
+
+    const int none = std::numeric_limits<int>::min();
+
+    for (int x = 0; x < SLOTS; x++)
+        for (int y = 0; y < SLOTS; y++) {
+            slot_chunks[x][y] = Point2i(none, none);
+            dirty[x][y] = false;
+        }
+}
+
+void
+Minimap::create_texture() {
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    // The levels hold every slot built so far, so uploading them whole
+    // brings all of the map back after a context loss
+    for (int level = 0; level < LEVELS; level++)
+        glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, SIZE >> level, SIZE >> level, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, levels[level].data());
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void
+Minimap::delete_texture() {
+    glDeleteTextures(1, &texture);
+
+    texture = 0;
+}
+
+void
+Minimap::explore(Point2i cell) {
+    for (int side = 0; side < 4; side++) {
+        Point2i d;
+        Point2i i = cell;
+
+        side_to_coords(side, d.x, d.y);
+
+        for (int step = 0; step <= view_distance; step++) {
+            for (int x = -1; x <= 1; x++)
+                for (int y = -1; y <= 1; y++)
+                    reveal(Point2i(i.x + x, i.y + y));
+
+            i = Point2i(i.x + d.x, i.y + d.y);
+
+            if (!maze.get_opened(i))
+                break;
+        }
+    }
+}
+
+void
+Minimap::reveal(Point2i cell) {
+    if (cell.x < 0 || cell.x >= maze.size().x || cell.y < 0 || cell.y >= maze.size().y)
+        return;
+
+    Point2i chunk(cell.x / chunk_size, cell.y / chunk_size);
+
+    auto& bits = explored[chunk.y * maze.chunks_count().x + chunk.x];
+    int bit = (cell.y % chunk_size) * chunk_size + cell.x % chunk_size;
+
+    if (bits[bit])
+        return;
+
+    bits[bit] = true;
+
+    Point2i slot(chunk.x % SLOTS, chunk.y % SLOTS);
+
+    // Chunks outside the ring are built in full once they get a slot
+    if (slot_chunks[slot.x][slot.y] == chunk)
+        dirty[slot.x][slot.y] = true;
+}
+
+void
+Minimap::follow(Point2i chunk) {
+    for (int x = chunk.x - SLOTS / 2 + 1; x <= chunk.x + SLOTS / 2; x++)
+        for (int y = chunk.y - SLOTS / 2 + 1; y <= chunk.y + SLOTS / 2; y++) {
+            Point2i slot((x % SLOTS + SLOTS) % SLOTS, (y % SLOTS + SLOTS) % SLOTS);
+
+            if (slot_chunks[slot.x][slot.y] == Point2i(x, y))
+                continue;
+
+            slot_chunks[slot.x][slot.y] = Point2i(x, y);
+            dirty[slot.x][slot.y] = true;
+        }
+}
+
+void
+Minimap::upload() {
+    int uploads = 0;
+
+    // Nearest slots first, rings of growing distance around the player
+    Point2i center((old_chunk.x % SLOTS + SLOTS) % SLOTS, (old_chunk.y % SLOTS + SLOTS) % SLOTS);
+
+    for (int ring = 0; ring <= SLOTS / 2; ring++)
+        for (int x = -ring; x <= ring; x++)
+            for (int y = -ring; y <= ring; y++) {
+                if (std::max(std::abs(x), std::abs(y)) != ring)
+                    continue;
+
+                Point2i slot((center.x + x + SLOTS) % SLOTS, (center.y + y + SLOTS) % SLOTS);
+
+                if (!dirty[slot.x][slot.y])
+                    continue;
+
+                if (uploads == uploads_per_frame)
+                    return;
+
+                build_slot(slot);
+                build_mips(slot);
+
+                dirty[slot.x][slot.y] = false;
+                uploads++;
+            }
+}
+
+void
+Minimap::build_slot(Point2i slot) {
+    const Point2i& chunk = slot_chunks[slot.x][slot.y];
+
+    for (int x = 0; x < chunk_size; x++)
+        for (int y = 0; y < chunk_size; y++) {
+            Point2i cell(chunk.x * chunk_size + x, chunk.y * chunk_size + y);
+
+            levels[0][(slot.y * chunk_size + y) * SIZE + slot.x * chunk_size + x] = texel(cell);
+        }
+}
+
+void
+Minimap::build_mips(Point2i slot) {
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    for (int level = 0; level < LEVELS; level++) {
+        int size  = SIZE >> level;
+        int block = std::max(1, chunk_size >> level);
+
+        // Past the chunk size one texel covers several slots
+        Point2i origin((slot.x * chunk_size) >> level, (slot.y * chunk_size) >> level);
+
+        if (level > 0)
+            for (int x = origin.x; x < origin.x + block; x++)
+                for (int y = origin.y; y < origin.y + block; y++)
+                    levels[level][y * size + x] = average(level - 1, Point2i(x, y));
+
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, size);
+        glTexSubImage2D(GL_TEXTURE_2D, level, origin.x, origin.y, block, block,
+                        GL_RGBA, GL_UNSIGNED_BYTE, &levels[level][origin.y * size + origin.x]);
+    }
+
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
+
+bool
+Minimap::is_explored(Point2i cell) const {
+    Point2i chunk(cell.x / chunk_size, cell.y / chunk_size);
+
+    auto it = explored.find(chunk.y * maze.chunks_count().x + chunk.x);
+
+    if (it == explored.end())
+        return false;
+
+    return it->second[(cell.y % chunk_size) * chunk_size + cell.x % chunk_size];
+}
+
+Minimap::Texel
+Minimap::texel(Point2i cell) const {
+    if (cell.x < 0 || cell.x >= maze.size().x || cell.y < 0 || cell.y >= maze.size().y ||
+            !is_explored(cell))
+        return Texel {0x00, 0x00, 0x00, 0x00};
+
+    if (cell == maze.exit())
+        return Texel {0x40, 0xC0, 0x40, 0xE0};
+
+    if (maze.get_opened(cell))
+        return Texel {0x20, 0x20, 0x20, 0xA0};
+
+    return Texel {0xE0, 0xE0, 0xE0, 0xE0};
+}
+
+Minimap::Texel
+Minimap::average(int level, Point2i texel) const {
+    int size = SIZE >> level;
+    int sum[4] = {0, 0, 0, 0};
+
+    for (int x = 0; x < 2; x++)
+        for (int y = 0; y < 2; y++) {
+            const Texel& source = levels[level][(texel.y * 2 + y) * size + texel.x * 2 + x];
+
+            sum[0] += source.r;
+            sum[1] += source.g;
+            sum[2] += source.b;
+            sum[3] += source.a;
+        }
+
+    return Texel {
+        static_cast<std::uint8_t>((sum[0] + 2) / 4),
+        static_cast<std::uint8_t>((sum[1] + 2) / 4),
+        static_cast<std::uint8_t>((sum[2] + 2) / 4),
+        static_cast<std::uint8_t>((sum[3] + 2) / 4)
+    };
+}
+
+void
+Minimap::draw(Pointf position, float yaw, float radius) {
+    GlState& gl_state = GlState::inst();
+
+    Point2i window_size = GraphicEngine::inst().scene_size();
+
+    float side   = window_size.y / 4.0f;
+    float margin = 16.0f;
+
+    Point2f min(window_size.x - margin - side, margin);
+    Point2f max(window_size.x - margin, margin + side);
+    Point2f center((min.x + max.x) / 2.0f, (min.y + max.y) / 2.0f);
+
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glOrtho(0.0, window_size.x, window_size.y, 0.0, -1.0, 1.0);
+
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    // North is up, so world Z runs down the screen and flips the winding
+    gl_state.disable(GL_DEPTH_TEST);
+    gl_state.disable(GL_CULL_FACE);
+
+    glBegin(GL_QUADS);
+    glColor4f(0.0f, 0.0f, 0.0f, 0.4f);
+    glVertex2f(min.x, min.y);
+    glVertex2f(max.x, min.y);
+    glVertex2f(max.x, max.y);
+    glVertex2f(min.x, max.y);
+    glEnd();
+
+    gl_state.enable(GL_TEXTURE_2D);
+
+    Point2f uv_min((position.x - radius) / SIZE, (position.z - radius) / SIZE);
+    Point2f uv_max((position.x + radius) / SIZE, (position.z + radius) / SIZE);
+
+    glColor3f(1.0f, 1.0f, 1.0f);
+
+    glBegin(GL_QUADS);
+    glTexCoord2f(uv_min.x, uv_min.y); glVertex2f(min.x, min.y);
+    glTexCoord2f(uv_max.x, uv_min.y); glVertex2f(max.x, min.y);
+    glTexCoord2f(uv_max.x, uv_max.y); glVertex2f(max.x, max.y);
+    glTexCoord2f(uv_min.x, uv_max.y); glVertex2f(min.x, max.y);
+    glEnd();
+
+    gl_state.disable(GL_TEXTURE_2D);
+
+    Point2f forward(std::sin(yaw), -std::cos(yaw));
+    Point2f right  (std::cos(yaw),  std::sin(yaw));
+
+    float arrow = side / 24.0f;
+
+    glBegin(GL_TRIANGLES);
+    glColor3f(1.0f, 0.3f, 0.2f);
+    glVertex2f(center.x + forward.x * arrow, center.y + forward.y * arrow);
+    glVertex2f(center.x + (-forward.x + right.x) * arrow * 0.6f,
+               center.y + (-forward.y + right.y) * arrow * 0.6f);
+    glVertex2f(center.x + (-forward.x - right.x) * arrow * 0.6f,
+               center.y + (-forward.y - right.y) * arrow * 0.6f);
+    glEnd();
+
+    gl_state.enable(GL_CULL_FACE);
+    gl_state.enable(GL_DEPTH_TEST);
+
+    glPopMatrix();
+
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+
+    glMatrixMode(GL_MODELVIEW);
+
+    GraphicEngine::inst().stats().draw_calls += 3;
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Chunk.hpp"
+#include "Point.hpp"
+#include "Point2.hpp"
+
+namespace mazemaze {
+
+class Maze;
+
+// Map of the explored part of the maze around the player.
+//
+// The texture is a ring of SLOTS x SLOTS chunks that follows the player, a
+// chunk always lands in the slot given by its coordinates modulo SLOTS. Only
+// slots that got a new chunk or newly explored cells are uploaded, together
+// with their part of a mip pyramid built on the CPU, so the cost of a frame
+// doesn't depend on the maze size.
+class Minimap {
+public:
+    explicit Minimap(Maze& maze);
+    ~Minimap();
+
+    void tick(Pointf position);
+    void render(Pointf position, float yaw);
+
+    // Cycles between the zoom levels and hidden
+    void zoom();
+
+    static const int SLOTS = 16;
+
+private:
+    struct Texel {
+        std::uint8_t r, g, b, a;
+    };
+
+    // Texels on a side and mip levels down to 1x1
+    static const int SIZE   = SLOTS * Chunk::SIZE;
+    static const int LEVELS = 9;
+
+    // Uploading every slot at once would stall the frame a new game starts on
+    static const int uploads_per_frame = 8;
+
+    Maze& maze;
+    unsigned int seed;
+
+    unsigned int texture;
+    int texture_resource;
+    int zoom_level;
+
+    Point2i old_cell;
+    Point2i old_chunk;
+
+    std::unordered_map<int, std::bitset<Chunk::SIZE * Chunk::SIZE>> explored;
+
+    Point2i slot_chunks[SLOTS][SLOTS];
+    bool    dirty[SLOTS][SLOTS];
+
+    std::vector<Texel> levels[LEVELS];
+
+    void reset();
+    void create_texture();
+    void delete_texture();
+    void explore(Point2i cell);
+    void reveal(Point2i cell);
+    void follow(Point2i chunk);
+    void upload();
+    void build_slot(Point2i slot);
+    void build_mips(Point2i slot);
+
+    bool  is_explored(Point2i cell) const;
+    Texel texel(Point2i cell) const;
+    Texel average(int level, Point2i texel) const;
+
+    void draw(Pointf position, float yaw, float radius);
+};
+
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2018-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -38,6 +38,7 @@ Player::Player(Pointf position) :
                100.0, 0.005, 100.0),
         camera_bobbing(nullptr),
         m_position(position),
+        old_position(position),
         speed(3.0f),
         height(0.65f),
         width(0.05f) {
@@ -58,6 +59,8 @@ Player::start(Maze& maze) {
     m_position.x = maze.start().x + 0.5f;
     m_position.z = maze.start().y + 0.5f;
 
+    old_position = m_position;
+
     cam_pos.set(Pointf(m_position.x, m_position.y + height, m_position.z));
 }
 
@@ -69,7 +72,8 @@ Player::tick(Game& game, float delta_time) {
     auto pi_2f = static_cast<float>(M_PI_2);
 
     auto& rotation = m_camera.rotation();
-    auto& cam_pos  = m_camera.position();
+
+    old_position = m_position;
 
     m_move_vector.x = 0.0f;
     m_move_vector.y = 0.0f;
@@ -107,6 +111,17 @@ Player::tick(Game& game, float delta_time) {
         try_move(game.maze(), Pointf(newx, m_position.y, newz));
     }
 
+    setup_camera_bobbing(settings);
+
+    tickable_handler.tick(*this, delta_time);
+}
+
+void
+Player::look(const Settings& settings) {
+    auto pi_2f = static_cast<float>(M_PI_2);
+
+    auto& rotation = m_camera.rotation();
+
     sf::Window& window = GraphicEngine::inst().window();
 
     sf::Vector2u window_half_size = window.getSize();
@@ -128,12 +143,41 @@ Player::tick(Game& game, float delta_time) {
         rotation.yaw() +
         (cursor.x - static_cast<int>(window_half_size.x)) * sensitivity
     );
+}
 
-    cam_pos.set(Pointf(m_position.x, m_position.y + height, m_position.z));
+void
+Player::interpolate(float alpha) {
+    Pointf position(old_position.x + (m_position.x - old_position.x) * alpha,
+                    old_position.y + (m_position.y - old_position.y) * alpha + height,
+                    old_position.z + (m_position.z - old_position.z) * alpha);
 
-    setup_camera_bobbing(settings);
+    if (camera_bobbing) {
+        float yaw = m_camera.rotation().yaw();
+        Point2f offset = camera_bobbing->offset(alpha);
 
-    tickable_handler.tick(*this, delta_time);
+        position.x += offset.x * std::cos(yaw);
+        position.y += offset.y;
+        position.z += offset.x * std::sin(yaw);
+    }
+
+    m_camera.position().set(position);
+}
+
+void
+Player::place(Pointf position, Rotation rotation) {
+    Point2f delta(position.x - m_position.x, position.z - m_position.z);
+    float length = std::hypot(delta.x, delta.y);
+
+    if (length > 0.0f)
+        m_move_vector = Point2f(delta.x / length, delta.y / length);
+    else
+        m_move_vector = Point2f(0.0f, 0.0f);
+
+    m_position = position;
+    old_position = position;
+
+    m_camera.position().set(Pointf(m_position.x, m_position.y + height, m_position.z));
+    m_camera.rotation() = rotation;
 }
 
 Camera&
@@ -151,6 +195,11 @@ Player::position() {
     return m_position;
 }
 
+const Point2f&
+Player::move_vector() const {
+    return m_move_vector;
+}
+
 void
 Player::try_move(Maze& maze, Pointf pos) {
     auto& m_pos = m_position;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2018-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -41,12 +41,16 @@ public:
 
     void start(Maze& maze);
     void tick(Game& game, float delta_time) override;
+    void look(const Settings& settings);
+    void interpolate(float alpha);
+    void place(Pointf position, Rotation rotation);
 
     Camera& camera();
 
     bool is_moving() const;
 
     Pointf& position();
+    const Point2f& move_vector() const;
 
 private:
     Camera m_camera;
@@ -54,6 +58,7 @@ private:
     CameraBobbing* camera_bobbing;
 
     Pointf  m_position;
+    Pointf  old_position;
     Point2f m_move_vector;
 
     float speed;
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Prefetcher.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Maze.hpp"
+#include "utils.hpp"
+
+namespace mazemaze {
+
+Prefetcher::Prefetcher(Maze& maze, int depth) :
+        maze(maze),
+        depth(depth),
+        old_cell(-1, -1) {}
+
+Prefetcher::~Prefetcher() = default;
+
+void
+Prefetcher::predict(Pointf position, Point2f move_vector) {
+    Point2i cell(static_cast<int>(position.x), static_cast<int>(position.z));
+
+    if (cell != old_cell) {
+        old_cell = cell;
+        walk(cell);
+    } else if (!direction_changed(move_vector)) {
+        return;
+    }
+
+    old_move_vector = move_vector;
+    score(position, move_vector);
+}
+
+const std::vector<Point2i>&
+Prefetcher::cells() const {
+    return m_cells;
+}
+
+bool
+Prefetcher::direction_changed(Point2f move_vector) const {
+    float length = std::hypot(move_vector.x, move_vector.y);
+    float old_length = std::hypot(old_move_vector.x, old_move_vector.y);
+
+    if (length == 0.0f || old_length == 0.0f)
+        return (length == 0.0f) != (old_length == 0.0f);
+
+    // Mouse look turns the move vector every frame, so only re-sort on
+    // noticeable turns
+    float cos = (move_vector.x * old_move_vector.x + move_vector.y * old_move_vector.y) /
+                (length * old_length);
+
+    return cos < 0.9f;
+}
+
+void
+Prefetcher::walk(Point2i cell) {
+    steps.clear();
+    m_cells.clear();
+
+    Point2i& size = maze.size();
+
+    if (cell.x < 0 || cell.x >= size.x || cell.y < 0 || cell.y >= size.y ||
+            !maze.get_opened(cell))
+        return;
+
+    int side_length = depth * 2 + 1;
+
+    visited.assign(side_length * side_length, false);
+    visited[depth * side_length + depth] = true;
+
+    steps.push_back(Step { cell, 0, 0.0f });
+
+    // Breadth-first walk along the corridors, so walls prune the prediction
+    for (std::size_t i = 0; i < steps.size(); i++) {
+        Step step = steps[i];
+
+        if (step.depth >= depth)
+            continue;
+
+        for (int side = 0; side < 4; side++) {
+            int dx;
+            int dy;
+
+            side_to_coords(side, dx, dy);
+
+            Point2i next(step.cell.x + dx, step.cell.y + dy);
+
+            if (next.x < 0 || next.x >= size.x || next.y < 0 || next.y >= size.y)
+                continue;
+
+            int index = (next.y - cell.y + depth) * side_length + next.x - cell.x + depth;
+
+            if (visited[index] || !maze.get_opened(next))
+                continue;
+
+            visited[index] = true;
+            steps.push_back(Step { next, step.depth + 1, 0.0f });
+        }
+    }
+}
+
+void
+Prefetcher::score(Pointf position, Point2f move_vector) {
+    float move_length = std::hypot(move_vector.x, move_vector.y);
+
+    for (auto& step : steps) {
+        step.score = step.depth;
+
+        if (move_length == 0.0f || step.depth == 0)
+            continue;
+
+        Point2f delta(step.cell.x + 0.5f - position.x, step.cell.y + 0.5f - position.z);
+
+        float cos = (delta.x * move_vector.x + delta.y * move_vector.y) /
+                    (std::hypot(delta.x, delta.y) * move_length);
+
+        // Cells ahead of the player are twice as likely as the ones behind
+        step.score *= 1.0f - cos / 3.0f;
+    }
+
+    std::stable_sort(steps.begin(), steps.end(), [] (const Step& a, const Step& b) {
+        return a.score < b.score;
+    });
+
+    m_cells.clear();
+
+    for (const auto& step : steps)
+        m_cells.push_back(step.cell);
+}
+
+}
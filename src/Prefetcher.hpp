@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Point.hpp"
+#include "Point2.hpp"
+
+namespace mazemaze {
+
+class Maze;
+
+class Prefetcher {
+public:
+    explicit Prefetcher(Maze& maze, int depth);
+    ~Prefetcher();
+
+    void predict(Pointf position, Point2f move_vector);
+
+    const std::vector<Point2i>& cells() const;
+
+private:
+    struct Step {
+        Point2i cell;
+        int depth;
+        float score;
+    };
+
+    Maze& maze;
+    int depth;
+
+    Point2i old_cell;
+    Point2f old_move_vector;
+
+    std::vector<Step> steps;
+    std::vector<bool> visited;
+    std::vector<Point2i> m_cells;
+
+    bool direction_changed(Point2f move_vector) const;
+    void walk(Point2i cell);
+    void score(Pointf position, Point2f move_vector);
+};
+
+}
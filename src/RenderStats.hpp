@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace mazemaze {
+
+struct RenderStats {
+    int         resident_chunks   = 0;
+    std::size_t resident_bytes    = 0;
+    std::size_t chunks_budget     = 0;
+    int         compiled_chunks   = 0;
+    int         prefetched_chunks = 0;
+    int         drawn_chunks      = 0;
+    int         culled_chunks     = 0;
+    int         occluded_chunks   = 0;
+    int         draw_calls        = 0;
+    int         saved_state_calls = 0;
+    float       resolution_scale  = 1.0f;
+};
+
+}
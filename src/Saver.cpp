@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -96,16 +96,8 @@ Saver::load(gui::MainMenu& main_menu) {
 
     stream.close();
 
-    auto& player = game->player();
-    auto& player_pos = player.position();
-    auto& rotation = player.camera().rotation();
-
-    player_pos.x = player_params[0];
-    player_pos.y = player_params[1];
-    player_pos.z = player_params[2];
-    rotation.set_pitch(player_params[3]);
-    rotation.set_yaw  (player_params[4]);
-    rotation.set_roll (player_params[5]);
+    game->player().place(Pointf(player_params[0], player_params[1], player_params[2]),
+                         Rotation(player_params[3], player_params[4], player_params[5]));
     maze.set_seed(maze_params[2]);
 
     auto& exit  = maze.exit();
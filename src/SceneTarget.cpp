@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SceneTarget.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include <SFML/OpenGL.hpp>
+#include <SFML/Window/Context.hpp>
+
+#include "GlState.hpp"
+#include "GraphicEngine.hpp"
+#include "Logger.hpp"
+#include "path_separator.hpp"
+#include "utils.hpp"
+
+#ifndef GL_FRAMEBUFFER
+# define GL_FRAMEBUFFER 0x8D40
+#endif
+
+#ifndef GL_RENDERBUFFER
+# define GL_RENDERBUFFER 0x8D41
+#endif
+
+#ifndef GL_FRAMEBUFFER_BINDING
+# define GL_FRAMEBUFFER_BINDING 0x8CA6
+#endif
+
+#ifndef GL_FRAMEBUFFER_COMPLETE
+# define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#endif
+
+#ifndef GL_COLOR_ATTACHMENT0
+# define GL_COLOR_ATTACHMENT0 0x8CE0
+#endif
+
+#ifndef GL_DEPTH_ATTACHMENT
+# define GL_DEPTH_ATTACHMENT 0x8D00
+#endif
+
+#ifndef GL_DEPTH_COMPONENT24
+# define GL_DEPTH_COMPONENT24 0x81A6
+#endif
+
+#ifndef GL_CLAMP_TO_EDGE
+# define GL_CLAMP_TO_EDGE 0x812F
+#endif
+
+#ifndef GL_READ_FRAMEBUFFER
+# define GL_READ_FRAMEBUFFER 0x8CA8
+#endif
+
+#ifndef GL_DRAW_FRAMEBUFFER
+# define GL_DRAW_FRAMEBUFFER 0x8CA9
+#endif
+
+#ifndef GL_MAX_SAMPLES
+# define GL_MAX_SAMPLES 0x8D57
+#endif
+
+#ifndef APIENTRY
+# define APIENTRY
+#endif
+
+namespace mazemaze {
+
+typedef void   (APIENTRY *GenFramebuffers)        (GLsizei n, GLuint* ids);
+typedef void   (APIENTRY *BindFramebuffer)        (GLenum target, GLuint id);
+typedef void   (APIENTRY *FramebufferTexture2D)   (GLenum target, GLenum attachment,
+                                                   GLenum textarget, GLuint texture,
+                                                   GLint level);
+typedef GLenum (APIENTRY *CheckFramebufferStatus) (GLenum target);
+typedef void   (APIENTRY *GenRenderbuffers)       (GLsizei n, GLuint* ids);
+typedef void   (APIENTRY *DeleteRenderbuffers)    (GLsizei n, const GLuint* ids);
+typedef void   (APIENTRY *BindRenderbuffer)       (GLenum target, GLuint id);
+typedef void   (APIENTRY *RenderbufferStorage)    (GLenum target, GLenum format,
+                                                   GLsizei width, GLsizei height);
+typedef void   (APIENTRY *FramebufferRenderbuffer)(GLenum target, GLenum attachment,
+                                                   GLenum renderbuffer_target,
+                                                   GLuint renderbuffer);
+typedef void   (APIENTRY *RenderbufferStorageMultisample)(GLenum target, GLsizei samples,
+                                                          GLenum format,
+                                                          GLsizei width, GLsizei height);
+typedef void   (APIENTRY *BlitFramebuffer)        (GLint src_x0, GLint src_y0,
+                                                   GLint src_x1, GLint src_y1,
+                                                   GLint dst_x0, GLint dst_y0,
+                                                   GLint dst_x1, GLint dst_y1,
+                                                   GLbitfield mask, GLenum filter);
+
+static GenFramebuffers         gl_gen_framebuffers          = nullptr;
+static BindFramebuffer         gl_bind_framebuffer          = nullptr;
+static FramebufferTexture2D    gl_framebuffer_texture_2d    = nullptr;
+static CheckFramebufferStatus  gl_check_framebuffer_status  = nullptr;
+static GenRenderbuffers        gl_gen_renderbuffers         = nullptr;
+static DeleteRenderbuffers     gl_delete_renderbuffers      = nullptr;
+static BindRenderbuffer        gl_bind_renderbuffer         = nullptr;
+static RenderbufferStorage     gl_renderbuffer_storage      = nullptr;
+static FramebufferRenderbuffer gl_framebuffer_renderbuffer  = nullptr;
+
+static RenderbufferStorageMultisample gl_renderbuffer_storage_multisample = nullptr;
+static BlitFramebuffer                gl_blit_framebuffer                 = nullptr;
+
+// Core names first, then the EXT ones of older drivers
+template <typename Function>
+static Function
+load(const char* name) {
+    auto function = sf::Context::getFunction(name);
+
+    if (!function)
+        function = sf::Context::getFunction((std::string(name) + "EXT").c_str());
+
+    return reinterpret_cast<Function>(function);
+}
+
+SceneTarget::SceneTarget() :
+        initialized(false),
+        m_supported(false),
+        m_max_samples(0),
+        framebuffer(0),
+        color(0),
+        depth(0),
+        multisample_framebuffer(0),
+        multisample_color(0),
+        multisample_depth(0),
+        previous_framebuffer(0),
+        m_size(0, 0),
+        samples(0),
+        smooth_failed(false) {}
+
+SceneTarget::~SceneTarget() = default;
+
+bool
+SceneTarget::supported() {
+    if (!initialized)
+        init();
+
+    return m_supported;
+}
+
+unsigned int
+SceneTarget::max_samples() {
+    return supported() ? m_max_samples : 0;
+}
+
+void
+SceneTarget::begin(Point2i size, unsigned int samples) {
+    if (size.x != m_size.x || size.y != m_size.y || samples != SceneTarget::samples)
+        create(size, samples);
+
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_framebuffer);
+    gl_bind_framebuffer(GL_FRAMEBUFFER, samples > 0 ? multisample_framebuffer : framebuffer);
+
+    glViewport(0, 0, m_size.x, m_size.y);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void
+SceneTarget::end(Point2i window_size, bool smooth) {
+    GlState& gl_state = GlState::inst();
+
+    if (samples > 0) {
+        gl_bind_framebuffer(GL_READ_FRAMEBUFFER, multisample_framebuffer);
+        gl_bind_framebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+        gl_blit_framebuffer(0, 0, m_size.x, m_size.y, 0, 0, m_size.x, m_size.y,
+                            GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    }
+
+    gl_bind_framebuffer(GL_FRAMEBUFFER, previous_framebuffer);
+
+    glViewport(0, 0, window_size.x, window_size.y);
+
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    gl_state.disable(GL_DEPTH_TEST);
+    gl_state.disable(GL_BLEND);
+    gl_state.enable(GL_TEXTURE_2D);
+
+    glBindTexture(GL_TEXTURE_2D, color);
+
+    smooth = smooth && load_smooth_shader();
+
+    if (smooth) {
+        smooth_shader->setUniform("texel", sf::Glsl::Vec2(1.0f / m_size.x, 1.0f / m_size.y));
+        sf::Shader::bind(smooth_shader.get());
+    }
+
+    glColor3f(1.0f, 1.0f, 1.0f);
+
+    glBegin(GL_QUADS);
+    glTexCoord2f(0.0f, 0.0f); glVertex2f(-1.0f, -1.0f);
+    glTexCoord2f(1.0f, 0.0f); glVertex2f( 1.0f, -1.0f);
+    glTexCoord2f(1.0f, 1.0f); glVertex2f( 1.0f,  1.0f);
+    glTexCoord2f(0.0f, 1.0f); glVertex2f(-1.0f,  1.0f);
+    glEnd();
+
+    if (smooth)
+        sf::Shader::bind(nullptr);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    gl_state.disable(GL_TEXTURE_2D);
+    gl_state.enable(GL_BLEND);
+    gl_state.enable(GL_DEPTH_TEST);
+
+    glPopMatrix();
+
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+
+    glMatrixMode(GL_MODELVIEW);
+
+    GraphicEngine::inst().stats().draw_calls++;
+}
+
+void
+SceneTarget::reset() {
+    // Framebuffer objects aren't shared between contexts, so the old names
+    // can't be deleted from the new one. Textures and renderbuffers are.
+    framebuffer = 0;
+    multisample_framebuffer = 0;
+
+    destroy();
+}
+
+Point2i
+SceneTarget::size() const {
+    return m_size;
+}
+
+void
+SceneTarget::init() {
+    initialized = true;
+
+    if (!sf::Context::isExtensionAvailable("GL_ARB_framebuffer_object") &&
+            !sf::Context::isExtensionAvailable("GL_EXT_framebuffer_object")) {
+        Logger::inst().log_debug("GL framebuffer objects are not available.");
+        return;
+    }
+
+    gl_gen_framebuffers         = load<GenFramebuffers>        ("glGenFramebuffers");
+    gl_bind_framebuffer         = load<BindFramebuffer>        ("glBindFramebuffer");
+    gl_framebuffer_texture_2d   = load<FramebufferTexture2D>   ("glFramebufferTexture2D");
+    gl_check_framebuffer_status = load<CheckFramebufferStatus> ("glCheckFramebufferStatus");
+    gl_gen_renderbuffers        = load<GenRenderbuffers>       ("glGenRenderbuffers");
+    gl_delete_renderbuffers     = load<DeleteRenderbuffers>    ("glDeleteRenderbuffers");
+    gl_bind_renderbuffer        = load<BindRenderbuffer>       ("glBindRenderbuffer");
+    gl_renderbuffer_storage     = load<RenderbufferStorage>    ("glRenderbufferStorage");
+    gl_framebuffer_renderbuffer = load<FramebufferRenderbuffer>("glFramebufferRenderbuffer");
+
+    if (!gl_gen_framebuffers || !gl_bind_framebuffer ||
+            !gl_framebuffer_texture_2d || !gl_check_framebuffer_status ||
+            !gl_gen_renderbuffers || !gl_delete_renderbuffers || !gl_bind_renderbuffer ||
+            !gl_renderbuffer_storage || !gl_framebuffer_renderbuffer) {
+        Logger::inst().log_debug("GL framebuffer object functions can not be loaded.");
+        return;
+    }
+
+    m_supported = true;
+
+    gl_renderbuffer_storage_multisample = load<RenderbufferStorageMultisample>(
+        "glRenderbufferStorageMultisample"
+    );
+    gl_blit_framebuffer = load<BlitFramebuffer>("glBlitFramebuffer");
+
+    if (gl_renderbuffer_storage_multisample && gl_blit_framebuffer) {
+        GLint max_samples = 0;
+        glGetIntegerv(GL_MAX_SAMPLES, &max_samples);
+
+        // Same cap the antialiasing options always had
+        m_max_samples = std::min(max_samples, 16);
+    }
+
+    Logger::inst().log_debug(fmt("Max scene target samples is %d.", m_max_samples));
+}
+
+void
+SceneTarget::create(Point2i size, unsigned int samples) {
+    destroy();
+
+    Logger::inst().log_debug(fmt("Creating %dx%d scene target with %d samples.",
+                                 size.x, size.y, samples));
+
+    m_size = size;
+    SceneTarget::samples = samples;
+
+    glGenTextures(1, &color);
+    glBindTexture(GL_TEXTURE_2D, color);
+
+    // Linear filtering does the upscaling
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size.x, size.y, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    GLint previous;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+
+    if (framebuffer == 0)
+        gl_gen_framebuffers(1, &framebuffer);
+
+    gl_bind_framebuffer(GL_FRAMEBUFFER, framebuffer);
+    gl_framebuffer_texture_2d(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color, 0);
+
+    // Drawing goes to the multisampled buffers then, the texture only gets
+    // the resolved colours
+    if (samples == 0) {
+        gl_gen_renderbuffers(1, &depth);
+        gl_bind_renderbuffer(GL_RENDERBUFFER, depth);
+        gl_renderbuffer_storage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size.x, size.y);
+
+        gl_framebuffer_renderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+    } else {
+        gl_gen_renderbuffers(1, &multisample_color);
+        gl_bind_renderbuffer(GL_RENDERBUFFER, multisample_color);
+        gl_renderbuffer_storage_multisample(GL_RENDERBUFFER, samples, GL_RGBA8, size.x, size.y);
+
+        gl_gen_renderbuffers(1, &multisample_depth);
+        gl_bind_renderbuffer(GL_RENDERBUFFER, multisample_depth);
+        gl_renderbuffer_storage_multisample(GL_RENDERBUFFER, samples, GL_DEPTH_COMPONENT24,
+                                            size.x, size.y);
+
+        if (multisample_framebuffer == 0)
+            gl_gen_framebuffers(1, &multisample_framebuffer);
+
+        gl_bind_framebuffer(GL_FRAMEBUFFER, multisample_framebuffer);
+        gl_framebuffer_renderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                    GL_RENDERBUFFER, multisample_color);
+        gl_framebuffer_renderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                                    GL_RENDERBUFFER, multisample_depth);
+    }
+
+    gl_bind_renderbuffer(GL_RENDERBUFFER, 0);
+
+    if (gl_check_framebuffer_status(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        Logger::inst().log_error("Scene target framebuffer is incomplete.");
+
+    gl_bind_framebuffer(GL_FRAMEBUFFER, previous);
+}
+
+void
+SceneTarget::destroy() {
+    if (color != 0) {
+        glDeleteTextures(1, &color);
+        color = 0;
+    }
+
+    for (unsigned int* renderbuffer : {&depth, &multisample_color, &multisample_depth})
+        if (*renderbuffer != 0) {
+            gl_delete_renderbuffers(1, renderbuffer);
+            *renderbuffer = 0;
+        }
+
+    m_size = Point2i(0, 0);
+    samples = 0;
+}
+
+bool
+SceneTarget::load_smooth_shader() {
+    if (smooth_failed)
+        return false;
+
+    if (smooth_shader)
+        return true;
+
+    if (!sf::Shader::isAvailable()) {
+        Logger::inst().log_warn("Shaders are not supported, edges won't be smoothed.");
+        smooth_failed = true;
+
+        return false;
+    }
+
+    smooth_shader = std::make_unique<sf::Shader>();
+
+    if (!smooth_shader->loadFromFile("data" PATH_SEPARATOR "smooth.frag",
+                                     sf::Shader::Type::Fragment)) {
+        Logger::inst().log_error("Can not load edge smoothing shader.");
+
+        smooth_shader.reset();
+        smooth_failed = true;
+
+        return false;
+    }
+
+    return true;
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <SFML/Graphics/Shader.hpp>
+
+#include "Point2.hpp"
+
+namespace mazemaze {
+
+// Offscreen colour and depth buffers the maze pass is drawn into when it
+// doesn't go straight to the window, then stretched over the viewport.
+// Multisampled buffers are resolved into the colour texture first, and a
+// post-process pass can smooth the edges on the way to the window.
+class SceneTarget {
+public:
+    explicit SceneTarget();
+    ~SceneTarget();
+
+    // Needs a current context, framebuffer objects are an extension in GL 1.x
+    bool supported();
+    unsigned int max_samples();
+
+    void begin(Point2i size, unsigned int samples);
+    void end(Point2i window_size, bool smooth);
+
+    // The old context is gone along with the framebuffer
+    void reset();
+
+    Point2i size() const;
+
+private:
+    bool initialized;
+    bool m_supported;
+    unsigned int m_max_samples;
+
+    unsigned int framebuffer;
+    unsigned int color;
+    unsigned int depth;
+
+    unsigned int multisample_framebuffer;
+    unsigned int multisample_color;
+    unsigned int multisample_depth;
+
+    int previous_framebuffer;
+
+    Point2i m_size;
+    unsigned int samples;
+
+    std::unique_ptr<sf::Shader> smooth_shader;
+    bool smooth_failed;
+
+    void init();
+    void create(Point2i size, unsigned int samples);
+    void destroy();
+    bool load_smooth_shader();
+};
+
+}
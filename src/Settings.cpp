@@ -40,6 +40,7 @@
 #include "path_separator.hpp"
 #include "GraphicEngine.hpp"
 #include "Game.hpp"
+#include "LightingShader.hpp"
 #include "Logger.hpp"
 
 #include "Gui/MainMenu.hpp"
@@ -89,7 +90,9 @@ Settings::Settings(bool readConfig) :
             Language(L"Українська", "uk_UA"),
             Language(L"Deutsch",    "de_DE")
         },
-        m_renderer(0) {
+        m_renderer(0),
+        m_chunk_cache_size(64),
+        m_inactive_cache_size(16) {
     init_data_dir();
     m_config_file = m_data_dir + PATH_SEPARATOR "config.json";
 
@@ -126,12 +129,20 @@ Settings::Settings(bool readConfig) :
     m_renderer = 3;
     m_show_fps = false;
     set_vsync(true);
+    set_fps_limit(0);
+    set_menu_fps_limit(60);
+    set_render_thread(false);
+    set_dynamic_resolution(false);
+    set_smooth_edges(false);
+    set_shaders(true);
     m_camera_bobbing = true;
+    m_baked_lighting = false;
 
     controls["up"]    = sf::Keyboard::Key::W;
     controls["down"]  = sf::Keyboard::Key::S;
     controls["right"] = sf::Keyboard::Key::D;
     controls["left"]  = sf::Keyboard::Key::A;
+    controls["minimap"] = sf::Keyboard::Key::M;
 }
 
 Settings::~Settings() = default;
@@ -156,6 +167,11 @@ Settings::max_antialiasing() const {
     return GraphicEngine::inst().max_antialiasing();
 }
 
+bool
+Settings::smooth_edges() const {
+    return GraphicEngine::inst().smooth_edges();
+}
+
 bool
 Settings::fullscreen() const {
     return GraphicEngine::inst().fullscreen();
@@ -166,6 +182,31 @@ Settings::vsync() const {
     return GraphicEngine::inst().vsync();
 }
 
+bool
+Settings::render_thread() const {
+    return GraphicEngine::inst().render_thread();
+}
+
+bool
+Settings::dynamic_resolution() const {
+    return GraphicEngine::inst().dynamic_resolution();
+}
+
+unsigned int
+Settings::fps_limit() const {
+    return GraphicEngine::inst().fps_limit();
+}
+
+unsigned int
+Settings::menu_fps_limit() const {
+    return GraphicEngine::inst().menu_fps_limit();
+}
+
+bool
+Settings::shaders() const {
+    return LightingShader::inst().enabled();
+}
+
 bool
 Settings::autosave() const {
     return m_autosave;
@@ -211,6 +252,21 @@ Settings::camera_bobbing() const {
     return m_camera_bobbing;
 }
 
+bool
+Settings::baked_lighting() const {
+    return m_baked_lighting;
+}
+
+unsigned int
+Settings::chunk_cache_size() const {
+    return m_chunk_cache_size;
+}
+
+unsigned int
+Settings::inactive_cache_size() const {
+    return m_inactive_cache_size;
+}
+
 void
 Settings::set_main_menu(gui::MainMenu* main_menu) {
     m_main_menu = main_menu;
@@ -279,6 +335,13 @@ Settings::set_antialiasing(unsigned int antialiasing) {
     m_antialiasing = antialiasing;
 }
 
+void
+Settings::set_smooth_edges(bool smooth_edges) {
+    Logger::inst().log_debug(fmt("Setting smooth edges to %s.", smooth_edges ? "true" : "false"));
+
+    GraphicEngine::inst().set_smooth_edges(smooth_edges);
+}
+
 void
 Settings::set_fullscreen(bool fullscreen) {
     Logger::inst().log_debug(fmt("Setting fullsreen to %s.", fullscreen ? "true" : "false"));
@@ -293,6 +356,43 @@ Settings::set_vsync(bool vsync) {
     GraphicEngine::inst().set_vsync(vsync);
 }
 
+void
+Settings::set_render_thread(bool render_thread) {
+    Logger::inst().log_debug(fmt("Setting render thread to %s.",
+                                 render_thread ? "true" : "false"));
+
+    GraphicEngine::inst().set_render_thread(render_thread);
+}
+
+void
+Settings::set_dynamic_resolution(bool dynamic_resolution) {
+    Logger::inst().log_debug(fmt("Setting dynamic resolution to %s.",
+                                 dynamic_resolution ? "true" : "false"));
+
+    GraphicEngine::inst().set_dynamic_resolution(dynamic_resolution);
+}
+
+void
+Settings::set_fps_limit(unsigned int fps_limit) {
+    Logger::inst().log_debug(fmt("Setting FPS limit to %d.", fps_limit));
+
+    GraphicEngine::inst().set_fps_limit(fps_limit);
+}
+
+void
+Settings::set_menu_fps_limit(unsigned int menu_fps_limit) {
+    Logger::inst().log_debug(fmt("Setting menu FPS limit to %d.", menu_fps_limit));
+
+    GraphicEngine::inst().set_menu_fps_limit(menu_fps_limit);
+}
+
+void
+Settings::set_shaders(bool shaders) {
+    Logger::inst().log_debug(fmt("Setting shaders to %s.", shaders ? "true" : "false"));
+
+    LightingShader::inst().set_enabled(shaders);
+}
+
 void
 Settings::set_autosave(bool autosave) {
     Logger::inst().log_debug(fmt("Setting autosave to %s.", autosave ? "true" : "false"));
@@ -343,6 +443,28 @@ Settings::set_camera_bobbing(float camera_bobbing) {
     m_camera_bobbing = camera_bobbing;
 }
 
+void
+Settings::set_baked_lighting(bool baked_lighting) {
+    Logger::inst().log_debug(fmt("Setting baked lighting to %s.", baked_lighting ? "true" : "false"));
+
+    m_baked_lighting = baked_lighting;
+}
+
+void
+Settings::set_chunk_cache_size(unsigned int chunk_cache_size) {
+    Logger::inst().log_debug(fmt("Setting chunk cache size to %d MiB.", chunk_cache_size));
+
+    m_chunk_cache_size = chunk_cache_size;
+}
+
+void
+Settings::set_inactive_cache_size(unsigned int inactive_cache_size) {
+    Logger::inst().log_debug(fmt("Setting inactive styles cache size to %d MiB.",
+                                 inactive_cache_size));
+
+    m_inactive_cache_size = inactive_cache_size;
+}
+
 void
 Settings::reset_locale() {
     // std::setlocale is not working on MinGW-w64
@@ -469,10 +591,19 @@ Settings::write_config() {
     Json::Value graphics = Json::objectValue;
 
     graphics["antialiasing"] = antialiasing();
+    graphics["smoothEdges"] = smooth_edges();
     graphics["fullscreen"] = fullscreen();
     graphics["vsync"] = vsync();
+    graphics["fpsLimit"] = fps_limit();
+    graphics["menuFpsLimit"] = menu_fps_limit();
+    graphics["renderThread"] = render_thread();
+    graphics["dynamicResolution"] = dynamic_resolution();
+    graphics["shaders"] = shaders();
     graphics["style"] = renderer();
     graphics["cameraBobbing"] = camera_bobbing();
+    graphics["bakedLighting"] = baked_lighting();
+    graphics["chunkCacheSize"] = chunk_cache_size();
+    graphics["inactiveCacheSize"] = inactive_cache_size();
 
     config["graphics"] = graphics;
 
@@ -513,10 +644,21 @@ Settings::read_config() {
         Json::Value graphics = config["graphics"];
 
         set_antialiasing(graphics["antialiasing"].asUInt());
+        set_smooth_edges(graphics.get("smoothEdges", smooth_edges()).asBool());
         set_fullscreen(graphics["fullscreen"].asBool());
         set_vsync(graphics["vsync"].asBool());
+        set_fps_limit(graphics.get("fpsLimit", fps_limit()).asUInt());
+        set_menu_fps_limit(graphics.get("menuFpsLimit", menu_fps_limit()).asUInt());
+        set_render_thread(graphics.get("renderThread", render_thread()).asBool());
+        set_dynamic_resolution(graphics.get("dynamicResolution",
+                                            dynamic_resolution()).asBool());
+        set_shaders(graphics.get("shaders", shaders()).asBool());
         set_renderer(graphics["style"].asInt());
         set_camera_bobbing(graphics["cameraBobbing"].asBool());
+        set_baked_lighting(graphics.get("bakedLighting", m_baked_lighting).asBool());
+        set_chunk_cache_size(graphics.get("chunkCacheSize", m_chunk_cache_size).asUInt());
+        set_inactive_cache_size(graphics.get("inactiveCacheSize",
+                                             m_inactive_cache_size).asUInt());
 
         set_lang(config["lang"].asString());
         set_autosave(config["autosave"].asBool());
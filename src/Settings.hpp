@@ -52,8 +52,14 @@ public:
     std::string                  lang() const;
     unsigned int                 antialiasing() const;
     unsigned int                 max_antialiasing() const;
+    bool                         smooth_edges() const;
     bool                         fullscreen() const;
     bool                         vsync() const;
+    unsigned int                 fps_limit() const;
+    unsigned int                 menu_fps_limit() const;
+    bool                         render_thread() const;
+    bool                         dynamic_resolution() const;
+    bool                         shaders() const;
     bool                         autosave() const;
     float                        autosave_time() const;
     int                          renderer() const;
@@ -63,13 +69,22 @@ public:
     float                        sensitivity() const;
     std::string                  data_dir() const;
     bool                         camera_bobbing() const;
+    bool                         baked_lighting() const;
+    unsigned int                 chunk_cache_size() const;
+    unsigned int                 inactive_cache_size() const;
 
     void set_main_menu(gui::MainMenu* main_menu);
 
     void set_lang(const std::string &lang);
     void set_antialiasing(unsigned int antialiasing);
+    void set_smooth_edges(bool smooth_edges);
     void set_fullscreen(bool fullscreen);
     void set_vsync(bool vsync);
+    void set_fps_limit(unsigned int fps_limit);
+    void set_menu_fps_limit(unsigned int menu_fps_limit);
+    void set_render_thread(bool render_thread);
+    void set_dynamic_resolution(bool dynamic_resolution);
+    void set_shaders(bool shaders);
     void set_autosave(bool autosave);
     void set_autosave_time(float autosave_time);
     void set_renderer(int id);
@@ -77,6 +92,9 @@ public:
     void set_key(const std::string& control, sf::Keyboard::Key key);
     void set_sensitivity(float sensitivity);
     void set_camera_bobbing(float camera_bobbing);
+    void set_baked_lighting(bool baked_lighting);
+    void set_chunk_cache_size(unsigned int chunk_cache_size);
+    void set_inactive_cache_size(unsigned int inactive_cache_size);
 
 private:
     std::string m_data_dir;
@@ -93,6 +111,9 @@ private:
     bool  m_show_fps;
     float m_sensitivity;
     bool  m_camera_bobbing;
+    bool  m_baked_lighting;
+    unsigned int m_chunk_cache_size;
+    unsigned int m_inactive_cache_size;
 
     std::map<std::string, sf::Keyboard::Key> controls;
 
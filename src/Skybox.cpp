@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -19,6 +19,9 @@
 
 #include <SFML/OpenGL.hpp>
 
+#include "GpuResources.hpp"
+#include "GraphicEngine.hpp"
+
 namespace mazemaze {
 
 Skybox::Skybox(int size, float red, float green, float blue) :
@@ -26,16 +29,21 @@ Skybox::Skybox(int size, float red, float green, float blue) :
         red(red),
         green(green),
         blue(blue),
-        list(0) {}
+        list(0),
+        resource(GpuResources::inst().add([this] () { compile(); },
+                                          [this] () { release(); })) {}
 
-Skybox::~Skybox() = default;
+Skybox::~Skybox() {
+    GpuResources::inst().remove(resource);
+}
 
 void
 Skybox::render() {
-    if (list == 0)
-        compile();
+    GpuResources::inst().ensure(resource);
 
     glCallList(list);
+
+    GraphicEngine::inst().stats().draw_calls++;
 }
 
 void
@@ -81,4 +89,10 @@ Skybox::compile() {
     glEndList();
 }
 
+void
+Skybox::release() {
+    glDeleteLists(list, 1);
+    list = 0;
+}
+
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2019-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -26,15 +26,20 @@ public:
     explicit Skybox(int size, float red, float green, float blue);
     ~Skybox() override;
 
+    Skybox(const Skybox&) = delete;
+    Skybox& operator=(const Skybox&) = delete;
+
 public:
     int size;
     float red;
     float green;
     float blue;
     int list;
+    int resource;
 
     void render() override;
     void compile();
+    void release();
 };
 
 }
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StarCatalogue.hpp"
+
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <random>
+
+#include <SFML/OpenGL.hpp>
+
+#include "GpuResources.hpp"
+#include "GraphicEngine.hpp"
+#include "utils.hpp"
+
+namespace mazemaze {
+
+StarCatalogue::StarCatalogue(int star_count) :
+        draw_list(0),
+        resource(GpuResources::inst().add([this] () { compile(); },
+                                          [this] () { release(); })) {
+    std::mt19937 rand_gen(0);
+    std::uniform_real_distribution<float> coord_interval(-1.0, 1.0);
+    std::uniform_int_distribution<> size_interval(0, 11);
+
+    std::vector<Pointf> positions;
+    std::vector<int> sizes;
+
+    positions.reserve(star_count);
+    sizes.reserve(star_count);
+
+    while (static_cast<int>(positions.size()) < star_count) {
+        Pointf rand(
+            coord_interval(rand_gen),
+            coord_interval(rand_gen),
+            coord_interval(rand_gen)
+        );
+
+        int size_rand = size_interval(rand_gen);
+
+        float distance = powfi(rand.x, 2) + powfi(rand.y, 2) + powfi(rand.z, 2);
+
+        if (distance <= 1.0f) {
+            distance = std::sqrt(distance);
+
+            positions.emplace_back(rand.x / distance, rand.y / distance, rand.z / distance);
+
+            if      (size_rand <= 7)
+                sizes.push_back(1);
+
+            else if (size_rand <= 10)
+                sizes.push_back(2);
+
+            else
+                sizes.push_back(3);
+        }
+    }
+
+    std::normal_distribution<float> temp_interval(7300.0f, 1500.0f);
+
+    static const float brightness[SIZES_COUNT] { 0.33f, 0.5f, 0.75f };
+
+    for (int i = 0; i < star_count; i++) {
+        auto color = temp_to_color(temp_interval(rand_gen));
+        auto& bucket = buckets[sizes[i] - 1];
+        float k = brightness[sizes[i] - 1];
+
+        bucket.insert(bucket.end(), {
+            positions[i].x, positions[i].y, positions[i].z,
+            color.x * k,    color.y * k,    color.z * k
+        });
+    }
+}
+
+StarCatalogue::~StarCatalogue() {
+    GpuResources::inst().remove(resource);
+}
+
+std::shared_ptr<StarCatalogue>
+StarCatalogue::get(int star_count) {
+    static std::mutex mutex;
+    static std::map<int, std::weak_ptr<StarCatalogue>> catalogues;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto catalogue = catalogues[star_count].lock();
+
+    if (!catalogue) {
+        catalogue = std::make_shared<StarCatalogue>(star_count);
+        catalogues[star_count] = catalogue;
+    }
+
+    return catalogue;
+}
+
+void
+StarCatalogue::render() {
+    // Compiled on first use, when there is surely a GL context
+    GpuResources::inst().ensure(resource);
+
+    glCallList(draw_list);
+
+    GraphicEngine::inst().stats().draw_calls++;
+}
+
+void
+StarCatalogue::compile() {
+    draw_list = glGenLists(1);
+    glNewList(draw_list, GL_COMPILE);
+
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    // One draw per point size; the arrays are copied into the list here
+    for (int i = 0; i < SIZES_COUNT; i++) {
+        if (buckets[i].empty())
+            continue;
+
+        const float* data = buckets[i].data();
+
+        glVertexPointer(3, GL_FLOAT, 6 * sizeof(float), data);
+        glColorPointer (3, GL_FLOAT, 6 * sizeof(float), data + 3);
+
+        glPointSize(i + 1);
+        glDrawArrays(GL_POINTS, 0, buckets[i].size() / 6);
+    }
+
+    glPopClientAttrib();
+
+    glEndList();
+}
+
+void
+StarCatalogue::release() {
+    glDeleteLists(draw_list, 1);
+    draw_list = 0;
+}
+
+Pointf
+StarCatalogue::temp_to_color(float temp) const {
+    // https://tannerhelland.com/2012/09/18/convert-temperature-rgb-algorithm-code.html
+
+    if (temp < 1000)
+        temp = 1000;
+
+    if (temp > 40000)
+        temp = 40000;
+
+    float r = 0.0f;
+    float g = 0.0f;
+    float b = 0.0f;
+
+    temp /= 100.0f;
+
+    if (temp <= 66.0f) {
+        r = 1.0f;
+    } else {
+        r = 1.287885654f * std::pow(temp - 60.0f, -0.1332047592f);
+
+        if (r > 1.0f)
+            r = 1.0f;
+
+        if (r < 0.0f)
+            r = 0.0f;
+    }
+
+    if (temp <= 66.0f) {
+        g = 0.388557823f * std::log(temp) - 0.629373313f;
+    } else {
+        g = 1.125477225f * std::pow(temp - 60.0f, -0.0755148492f);
+    }
+
+    if (g > 1.0f)
+        g = 1.0f;
+
+    if (g < 0.0f)
+        g = 0.0f;
+
+    if (temp >= 66.0f) {
+        b = 1.0f;
+    } else if (temp <= 19.0f) {
+        b = 0.0f;
+    } else {
+        b = 0.541084888f * std::log(temp - 10.0f) - 1.191581222f;
+
+        if (b > 1.0f)
+            b = 1.0f;
+
+        if (b < 0.0f)
+            b = 0.0f;
+    }
+
+    return Pointf(r, g, b);
+}
+
+}
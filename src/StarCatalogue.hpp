@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "Point.hpp"
+
+namespace mazemaze {
+
+// Generated star positions and colours, shared by every StarSky with the
+// same star count. Lives as long as any StarSky references it.
+class StarCatalogue {
+public:
+    explicit StarCatalogue(int star_count);
+    ~StarCatalogue();
+
+    StarCatalogue(const StarCatalogue&) = delete;
+    StarCatalogue& operator=(const StarCatalogue&) = delete;
+
+    static std::shared_ptr<StarCatalogue> get(int star_count);
+
+    void render();
+
+private:
+    static const int SIZES_COUNT = 3;
+
+    // Interleaved position and colour, one bucket per point size. Kept to
+    // compile the list again after the context is lost.
+    std::vector<float> buckets[SIZES_COUNT];
+
+    unsigned int draw_list;
+    int resource;
+
+    void   compile();
+    void   release();
+    Pointf temp_to_color(float temp) const;
+};
+
+}
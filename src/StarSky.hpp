@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ * Copyright (c) 2018-2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -17,12 +17,12 @@
 
 #pragma once
 
-#include <vector>
+#include <memory>
 
 #include "IRenderable.hpp"
 #include "ITickable.hpp"
+#include "StarCatalogue.hpp"
 #include "Rotation.hpp"
-#include "Point.hpp"
 
 namespace mazemaze {
 
@@ -34,35 +34,20 @@ public:
     void generate();
 
     void render() override;
+    void sync() override;
     void tick(void*, float delta_time) override;
     void set_time(float time);
 
 private:
-    struct Star {
-        float x;
-        float y;
-        float z;
-        float r;
-        float g;
-        float b;
-        int size;
-    };
-
-    int star_count;
-
     float distance;
 
     Rotation m_rotation;
 
     float time;
+    float shown_time;
     float time_speed;
 
-    unsigned int draw_list;
-
-    std::vector<Star> stars;
-
-    void   compile();
-    Pointf temp_to_color(float temp) const;
+    std::shared_ptr<StarCatalogue> catalogue;
 };
 
 }
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorkerPool.hpp"
+
+namespace mazemaze {
+
+WorkerPool::WorkerPool(unsigned int threads) :
+        job(nullptr),
+        count(0),
+        next(0),
+        done(0),
+        active(0),
+        generation(0),
+        stopping(false) {
+    for (unsigned int i = 0; i < threads; i++)
+        WorkerPool::threads.emplace_back([this] { work(); });
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        stopping = true;
+    }
+
+    start.notify_all();
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+void
+WorkerPool::run(int count, const std::function<void(int)>& job) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        // A worker that woke up too late for the last batch may still be
+        // looking at its counters
+        finished.wait(lock, [this] { return active == 0; });
+
+        WorkerPool::job   = &job;
+        WorkerPool::count = count;
+        next = 0;
+        done = 0;
+        generation++;
+    }
+
+    start.notify_all();
+
+    int taken = take_jobs(job, count);
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    done += taken;
+
+    finished.wait(lock, [this, count] { return done == count; });
+
+    WorkerPool::job = nullptr;
+}
+
+unsigned int
+WorkerPool::size() const {
+    return threads.size();
+}
+
+unsigned int
+WorkerPool::default_size() {
+    unsigned int cores = std::thread::hardware_concurrency();
+
+    return cores > 1 ? cores - 1 : 0;
+}
+
+void
+WorkerPool::work() {
+    unsigned int seen = 0;
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    for (;;) {
+        start.wait(lock, [this, seen] { return stopping || generation != seen; });
+
+        if (stopping)
+            return;
+
+        seen = generation;
+
+        if (job == nullptr)
+            continue;
+
+        const std::function<void(int)>& current = *job;
+        int current_count = count;
+
+        active++;
+        lock.unlock();
+
+        int taken = take_jobs(current, current_count);
+
+        lock.lock();
+        active--;
+        done += taken;
+
+        finished.notify_all();
+    }
+}
+
+int
+WorkerPool::take_jobs(const std::function<void(int)>& job, int count) {
+    int taken = 0;
+
+    for (int i = next++; i < count; i = next++) {
+        job(i);
+        taken++;
+    }
+
+    return taken;
+}
+
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mazemaze {
+
+// Fixed set of threads that split a batch of independent jobs. The calling
+// thread takes jobs as well, so a pool of zero threads runs them serially.
+class WorkerPool {
+public:
+    explicit WorkerPool(unsigned int threads);
+    ~WorkerPool();
+
+    // Calls job(0) .. job(count - 1) and returns when all of them are done
+    void run(int count, const std::function<void(int)>& job);
+
+    unsigned int size() const;
+
+    // One worker per core besides the calling thread
+    static unsigned int default_size();
+
+private:
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable start;
+    std::condition_variable finished;
+
+    const std::function<void(int)>* job;
+    int count;
+    std::atomic<int> next;
+    int done;
+    int active;
+    unsigned int generation;
+    bool stopping;
+
+    void work();
+    int  take_jobs(const std::function<void(int)>& job, int count);
+};
+
+}
@@ -16,10 +16,16 @@
  */
 
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
 #include <gettext.h>
 
 #include <SFGUI/SFGUI.hpp>
 
+#include "Benchmark.hpp"
+#include "CameraPath.hpp"
 #include "GraphicEngine.hpp"
 #include "Settings.hpp"
 #include "Logger.hpp"
@@ -29,8 +35,64 @@
 
 using namespace mazemaze;
 
+static Point2i
+parse_size(const char* text) {
+    Point2i size;
+
+    if (std::sscanf(text, "%dx%d", &size.x, &size.y) != 2)
+        size.y = size.x = std::atoi(text);
+
+    return size;
+}
+
+static int
+run_benchmark(int argc, char* argv[]) {
+    Point2i maze_size(50, 50);
+    Point2i resolution(854, 480);
+    unsigned int seed = 0;
+    int frames = 600;
+    const char* replay = nullptr;
+
+    for (int i = 1; i + 1 < argc; i++) {
+        if      (std::strcmp(argv[i], "--frames") == 0)
+            frames = std::atoi(argv[++i]);
+
+        else if (std::strcmp(argv[i], "--seed") == 0)
+            seed = std::strtoul(argv[++i], nullptr, 10);
+
+        else if (std::strcmp(argv[i], "--maze") == 0)
+            maze_size = parse_size(argv[++i]);
+
+        else if (std::strcmp(argv[i], "--resolution") == 0)
+            resolution = parse_size(argv[++i]);
+
+        else if (std::strcmp(argv[i], "--replay") == 0)
+            replay = argv[++i];
+    }
+
+    // Defaults only, so the numbers don't depend on the user's config
+    Settings settings(false);
+    sfg::SFGUI sfgui;
+    CameraPath path;
+
+    if (replay && !path.load(replay)) {
+        Logger::inst().log_error(fmt("Can not load recording %s.", replay));
+        return 1;
+    }
+
+    Benchmark benchmark = replay ? Benchmark(settings, path)
+                                 : Benchmark(settings, maze_size, seed, frames);
+
+    if (!benchmark.run(resolution))
+        return 1;
+
+    benchmark.print(std::cout);
+
+    return 0;
+}
+
 int
-main() {
+main(int argc, char* argv[]) {
     {
         using namespace std::chrono;
 
@@ -49,6 +111,16 @@ main() {
     textdomain("mazemaze");
     bind_textdomain_codeset("mazemaze", "UTF-8");
 
+    const char* record = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--benchmark") == 0 || std::strcmp(argv[i], "--replay") == 0)
+            return run_benchmark(argc, argv);
+
+        if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+            record = argv[++i];
+    }
+
     Settings settings;
     sfg::SFGUI sfgui;
     GraphicEngine& engine = GraphicEngine::inst();
@@ -59,6 +131,9 @@ main() {
 
     settings.set_main_menu(&main_menu);
 
+    if (record)
+        main_menu.set_record_path(record);
+
     engine.loop(sfgui, main_menu);
 
     return 0;
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026, Мира Странная <rsxrwscjpzdzwpxaujrr@yahoo.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+
+#include "../MeshCache.hpp"
+
+using namespace mazemaze;
+
+int
+main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::fprintf(stderr, "Usage: %s <source.obj> <output.mesh>\n", argv[0]);
+        return 2;
+    }
+
+    if (!MeshCache::convert(argv[1], argv[2])) {
+        std::fprintf(stderr, "Can't convert %s to %s\n", argv[1], argv[2]);
+        return 1;
+    }
+
+    return 0;
+}